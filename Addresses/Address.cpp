@@ -7,18 +7,39 @@
  *				An Address consists of a Street, City, State, and Zip code
  **/
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <regex>
-#include <sstream>
+#include <utility>
 #include <iostream>
-#include <map>
-#include <algorithm>
-#include <locale>
 
 #include "Addresses/Address.hpp"
+#include "Addresses/States.hpp"
+#include "Addresses/ZipCode.hpp"
 
 namespace Addresses {
 
+	namespace {
+		// the state and zip code rules, without throwing
+		Address::Error parseState(Utilities::StringView code, States::Ordinal & state) noexcept {
+			// if the length is 2, it's an abbreviation. Look it up in the state table (case insensitive, supports input such as "Wa" or "wa")
+			if (code.length() == 2) {
+				state = States::fromCode(code.data(), code.length());
+				return state != States::NONE ? Address::Error::NONE : Address::Error::STATE_ABBREVIATION;
+			}
+			// it's not an abbreviation, look up the long name and make sure it's valid (case insensitive, supports input such as "WAshington" or "washington")
+			state = States::fromName(code.data(), code.length());
+			return state != States::NONE ? Address::Error::NONE : Address::Error::STATE_NAME;
+		}
+
+		// Zip code rules:  5 digits, not all are zero and not all are nine, optionally followed
+		// by a hyphen and 4 digits, not all are zero and not all are nine.
+		Address::Error parseZipCode(Utilities::StringView code, ZipCode::Packed & zip) noexcept {
+			zip = ZipCode::parse(code.data(), code.length());
+			return zip != ZipCode::NONE ? Address::Error::NONE : Address::Error::ZIP_CODE;
+		}
+	}
+
 	// constructors
 	Address::Address(std::string   street,
 		std::string   city,
@@ -26,20 +47,16 @@ namespace Addresses {
 		const std::string & zip) {
 
 		// set the street and city
-		this->street(street);
-		this->city(city);
+		this->street(std::move(street));
+		this->city(std::move(city));
 
 		// try to set the state and zip
-		try {
-			this->state(stateCode);
-			this->zipCode(zip);
-		}
-		// build up the stack trace
-		catch (StateCodeException & ex) {
-			throw StateCodeException(ex, "", __LINE__, __func__, __FILE__);
+		Error error = tryState(stateCode);
+		if (error == Error::NONE) {
+			error = tryZipCode(zip);
 		}
-		catch (ZipCodeException & ex) {
-			throw ZipCodeException(ex, "", __LINE__, __func__, __FILE__);
+		if (error != Error::NONE) {
+			raise(error, __LINE__, __func__, __FILE__);
 		}
 	}
 
@@ -49,146 +66,98 @@ namespace Addresses {
 		unsigned long    zip) {
 
 		// set the street and city
-		this->street(street);
-		this->city(city);
+		this->street(std::move(street));
+		this->city(std::move(city));
 
 		// try to set the state and zip
-		try {
-			this->state(stateCode);
-			this->zipCode(zip);
+		Error error = tryState(stateCode);
+		if (error == Error::NONE) {
+			error = tryZipCode(zip);
+		}
+		if (error != Error::NONE) {
+			raise(error, __LINE__, __func__, __FILE__);
+		}
+	}
+
+	Address::Error Address::tryMake(Utilities::StringView street,
+		Utilities::StringView city,
+		Utilities::StringView stateCode,
+		Utilities::StringView zip,
+		Address & address) {
+
+		// validate before building any strings
+		States::Ordinal state;
+		Error error = parseState(stateCode, state);
+		if (error != Error::NONE) {
+			return error;
+		}
+		ZipCode::Packed packed;
+		error = parseZipCode(zip, packed);
+		if (error != Error::NONE) {
+			return error;
+		}
+
+		address._street.assign(street.data(), street.size());
+		address._city.assign(city.data(), city.size());
+		address._state = state;
+		address._zip = packed;
+		address.forgetHash();
+
+		return Error::NONE;
+	}
+
+	/****************************
+	* Errors
+	*****************************/
+	const char * Address::describe(Error error) noexcept {
+		switch (error) {
+			case Error::NONE:                return "No error";
+			case Error::STATE_ABBREVIATION:  return "State abbreviation not valid";
+			case Error::STATE_NAME:          return "State name not valid";
+			case Error::ZIP_CODE:            return "Invalid zip code string entered";
+			case Error::ZIP_CODE_VALUE:      return "Invalid zip code long value entered";
+			case Error::EMPTY_RECORD:        return "Record is empty";
 		}
-		// build up the stack trace
-		catch (StateCodeException & ex) {
-			throw StateCodeException(ex, "", __LINE__, __func__, __FILE__);
+		return "Unknown error";
+	}
+
+	void Address::raise(Error error, int lineNumber, const char * functionName, const char * fileName) {
+		if (error == Error::STATE_ABBREVIATION || error == Error::STATE_NAME) {
+			throw StateCodeException(describe(error), lineNumber, functionName, fileName);
 		}
-		catch (ZipCodeException & ex) {
-			throw ZipCodeException(ex, "", __LINE__, __func__, __FILE__);
+		if (error == Error::EMPTY_RECORD) {
+			throw AddressExceptions(describe(error), lineNumber, functionName, fileName);
 		}
+		throw ZipCodeException(describe(error), lineNumber, functionName, fileName);
+	}
+
+	// a cached hash, if there is one, no longer describes the address
+	void Address::forgetHash() noexcept {
+#ifdef ADDRESSES_CACHE_HASH
+		_hash.reset();
+#endif
 	}
 
 	/****************************
 	* Modifier section
 	*****************************/
 	Address &   Address::street(std::string     numbersAndName) noexcept {
-		_street = numbersAndName;
+		_street = std::move(numbersAndName);
+		forgetHash();
 
 		return *this;
 	}
 	Address &   Address::city(std::string     name) noexcept {
-		_city = name;
+		_city = std::move(name);
+		forgetHash();
 
 		return *this;
 	}
 	// Must be a valid two digit code, state name, or standard state abbreviation
 	Address &   Address::state(std::string     code) {
-
-		// map containing the state codes and their names
-		const std::map<std::string, std::string> states = 
-		{
-			{ "AL","Alabama" },
-			{ "AK","Alaska" },
-			{ "AZ","Arizona" },
-			{ "AR","Arkansas" },
-			{ "CA","California" },
-			{ "CO","Colorado" },
-			{ "CT","Connecticut" },
-			{ "DE","Delaware" },
-			{ "FL","Florida" },
-			{ "GA","Georgia" },
-			{ "HI","Hawaii" },
-			{ "ID","Idaho" },
-			{ "IL","Illinois" },
-			{ "IN","Indiana" },
-			{ "IA","Iowa" },
-			{ "KS","Kansas" },
-			{ "KY","Kentucky" },
-			{ "LA","Louisiana" },
-			{ "ME","Maine" },
-			{ "MD","Maryland" },
-			{ "MA","Massachusetts" },
-			{ "MI","Michigan" },
-			{ "MN","Minnesota" },
-			{ "MS","Mississippi" },
-			{ "MO","Missouri" },
-			{ "MT","Montana" },
-			{ "NE","Nebraska" },
-			{ "NV","Nevada" },
-			{ "NH","New Hampshire" },
-			{ "NJ","New Jersey" },
-			{ "NM","New Mexico" },
-			{ "NY","New York" },
-			{ "NC","North Carolina" },
-			{ "ND","North Dakota" },
-			{ "OH","Ohio" },
-			{ "OK","Oklahoma" },
-			{ "OR","Oregon" },
-			{ "PA","Pennsylvania" },
-			{ "RI","Rhode Island" },
-			{ "SC","South Carolina" },
-			{ "SD","South Dakota" },
-			{ "TN","Tennessee" },
-			{ "TX","Texas" },
-			{ "UT","Utah" },
-			{ "VT","Vermont" },
-			{ "VA","Virginia" },
-			{ "WA","Washington" },
-			{ "WV","West Virginia" },
-			{ "WI","Wisconsin" },
-			{ "WY","Wyoming" },
-			{ "DC","District of Columbia" },
-		};
-
-		// conversion functions
-		auto toupper = [](char c) {
-			return std::toupper(c, std::locale());
-		};
-		auto tolower = [](char c) {
-			return std::tolower(c, std::locale());
-		};
-
-		// if the length is 2, it's an abbreviation. Look it up in the map
-		if (code.length() == 2) {
-			// convert to uppercase -- supports input such as "Wa" or "wa"
-			std::transform(code.begin(), code.end(), code.begin(), toupper);
-
-			std::map<std::string, std::string>::const_iterator itr = states.find(code);
-
-			// if the key was found
-			if (itr != states.cend()) {
-				_state = itr->second;
-			}
-			// throw an exception
-			else {
-				throw StateCodeException("State abbreviation not valid", __LINE__, __func__, __FILE__);
-			}
-		}
-		// it's not an abbreviation, look up the long name and make sure it's valid
-		else {
-			// convert to first letter capitalized, supporting input such as "WAshington" or "washington"
-			std::transform(code.begin(), code.begin() + 1, code.begin(), toupper);
-			std::transform(code.begin() + 1, code.end(), code.begin() + 1, tolower);
-
-			// function to return whether or not the value matches the function parameter supplied
-			auto nameExists = [code,toupper,tolower](auto value) {
-				// convert the value in map to same format as code
-				std::transform(value.second.begin(), value.second.begin() + 1, value.second.begin(), toupper);
-				std::transform(value.second.begin() + 1, value.second.end(), value.second.begin() + 1, tolower);
-
-				// compare
-				return value.second == code;
-			};
-
-			// find the state in the map
-			std::map<std::string, std::string>::const_iterator itr = std::find_if(states.cbegin(), states.cend(), nameExists);
-
-			// the long name was found in the map
-			if (itr != states.cend()) {
-				_state = itr->second; // use the value pulled from the map
-			}
-			// throw exception
-			else {
-				throw StateCodeException("State name not valid", __LINE__, __func__, __FILE__);
-			}
+		const Error error = tryState(code);
+		if (error != Error::NONE) {
+			raise(error, __LINE__, __func__, __FILE__);
 		}
 
 		return *this;
@@ -197,36 +166,71 @@ namespace Addresses {
 	// Zip code rules:  5 digits, not all are zero and not all are nine, optionally followed
 	// by a hyphen and 4 digits, not all are zero and not all are nine.
 	Address &   Address::zipCode(std::string     code) {
-		// regex to validate the zip code (raw string delimiter /( )/ )
-		std::regex zipRegex( R"/((?!0{5})(?!9{5})\d{5}(-(?!0{4})(?!9{4})\d{4})?)/" );
-
-		// if the match is successful, assign it
-		if (std::regex_match(code, zipRegex)) {
-			_zip = code;
-		}
-		// else, throw exception
-		else {
-			throw ZipCodeException("Invalid zip code string entered", __LINE__, __func__, __FILE__);
+		const Error error = tryZipCode(code);
+		if (error != Error::NONE) {
+			raise(error, __LINE__, __func__, __FILE__);
 		}
 
 		return *this;
 	}
 	
 	Address &   Address::zipCode(unsigned long   code) {
-		try {
-			// convert to std::string
-			std::string zipStr(std::to_string(code));
+		const Error error = tryZipCode(code);
+		if (error != Error::NONE) {
+			raise(error, __LINE__, __func__, __FILE__);
+		}
 
-			// need to pad the code with 0's if the zip code is less than 10000
-			std::string pad(5 - zipStr.length(), '0');
-			zipStr = pad + zipStr;
+		return *this;
+	}
 
-			// call std::string version
-			zipCode(zipStr);
+	Address::Error Address::tryState(Utilities::StringView code) noexcept {
+		States::Ordinal state;
+		const Error error = parseState(code, state);
+		if (error == Error::NONE) {
+			_state = state; // the name is pulled from the table when asked for
+			forgetHash();
 		}
-		catch (ZipCodeException & ex) {
-			throw ZipCodeException(ex, "Invalid zip code long value entered", __LINE__, __func__, __FILE__);
+		return error;
+	}
+
+	Address::Error Address::tryZipCode(Utilities::StringView code) noexcept {
+		ZipCode::Packed zip;
+		const Error error = parseZipCode(code, zip);
+		if (error == Error::NONE) {
+			_zip = zip;
+			forgetHash();
+		}
+		return error;
+	}
+
+	Address::Error Address::tryZipCode(unsigned long code) noexcept {
+		// codes less than 10000 are padded with 0's, codes longer than 5 digits are not valid
+		const ZipCode::Packed zip = ZipCode::parse(code);
+		if (zip == ZipCode::NONE) {
+			return Error::ZIP_CODE_VALUE;
+		}
+		_zip = zip;
+		forgetHash();
+		return Error::NONE;
+	}
+
+	Address &   Address::stateOrdinal(States::Ordinal state) {
+		if (state == States::NONE || state > States::COUNT) {
+			throw StateCodeException("State ordinal not valid", __LINE__, __func__, __FILE__);
+		}
+		_state = state;
+		forgetHash();
+
+		return *this;
+	}
+
+	Address &   Address::packedZipCode(ZipCode::Packed zip) {
+		// valid packed zip codes are exactly the ones parse() can produce
+		if (zip == ZipCode::NONE || ZipCode::parse(ZipCode::zip5(zip), ZipCode::plus4(zip)) != zip) {
+			throw ZipCodeException("Invalid packed zip code entered", __LINE__, __func__, __FILE__);
 		}
+		_zip = zip;
+		forgetHash();
 
 		return *this;
 	}
@@ -241,21 +245,104 @@ namespace Addresses {
 		return _city;
 	}
 	std::string Address::state() const noexcept {
-		return _state;
+		return std::string(States::name(_state), States::nameLength(_state));
 	}
 	std::string Address::zipCode() const noexcept {
+		char buffer[ZipCode::MAX_LENGTH];
+		return std::string(buffer, ZipCode::format(_zip, buffer));
+	}
+	States::Ordinal Address::stateOrdinal() const noexcept {
+		return _state;
+	}
+	ZipCode::Packed Address::packedZipCode() const noexcept {
 		return _zip;
 	}
+	// the fields operator== compares, with the zip code cut to 5 digits the same way
+	std::size_t Address::hash() const noexcept {
+		auto compute = [this]() {
+			const std::uint64_t seed = (static_cast<std::uint64_t>(_state) << 32) | ZipCode::zip5(_zip);
+			return Utilities::Hash::string(_street, Utilities::Hash::string(_city, seed));
+		};
+#ifdef ADDRESSES_CACHE_HASH
+		return static_cast<std::size_t>(_hash.get(compute));
+#else
+		return static_cast<std::size_t>(compute());
+#endif
+	}
+	Utilities::StringView Address::streetView() const noexcept {
+		return _street;
+	}
+	Utilities::StringView Address::cityView() const noexcept {
+		return _city;
+	}
+	Utilities::StringView Address::stateView() const noexcept {
+		return Utilities::StringView(States::name(_state), States::nameLength(_state));
+	}
 
 	// conversion operator
 	Address::operator std::string() const
 	{
-		// use the << operator to produce a stringstream
-		std::ostringstream oss;
-		oss << *this;
+		std::string record;
+		appendTo(record);
 
 		// return the string representation
-		return oss.str();
+		return record;
+	}
+
+	/***********************
+	* record formatting
+	**********************/
+	void Address::appendTo(std::string & record) const {
+		char zip[ZipCode::MAX_LENGTH];
+		const std::size_t zipLength = ZipCode::format(_zip, zip);
+
+		Utilities::Records::append(record, { _street, _city, stateView(), Utilities::StringView(zip, zipLength) });
+	}
+
+	std::size_t Address::formatTo(char * buffer, std::size_t size) const noexcept {
+		char zip[ZipCode::MAX_LENGTH];
+		const std::size_t zipLength = ZipCode::format(_zip, zip);
+
+		return Utilities::Records::format(buffer, size, { _street, _city, stateView(), Utilities::StringView(zip, zipLength) });
+	}
+
+	/***********************
+	* binary serialization
+	**********************/
+	void Address::serialize(Utilities::Binary::Buffer & buffer) const {
+		const std::size_t record = buffer.beginRecord(Utilities::Binary::RecordType::ADDRESS);
+		buffer.put8(_state)
+		      .put32(_zip)
+		      .putString(_street)
+		      .putString(_city);
+		buffer.endRecord(record);
+	}
+
+	Address & Address::deserialize(Utilities::Binary::Reader & reader) {
+		// read every field before changing anything
+		Utilities::Binary::Reader payload = reader.record(Utilities::Binary::RecordType::ADDRESS);
+		const States::Ordinal state          = payload.get8();
+		const ZipCode::Packed zip            = payload.get32();
+		const Utilities::StringView street   = payload.getString();
+		const Utilities::StringView city     = payload.getString();
+
+		// a default constructed address has neither a state nor a zip code, so NONE is allowed for both
+		if (!reader.trusted()) {
+			if (state > States::COUNT) {
+				throw StateCodeException("Serialized state ordinal not valid", __LINE__, __func__, __FILE__);
+			}
+			if (zip != ZipCode::NONE && ZipCode::parse(ZipCode::zip5(zip), ZipCode::plus4(zip)) != zip) {
+				throw ZipCodeException("Serialized zip code not valid", __LINE__, __func__, __FILE__);
+			}
+		}
+
+		_street.assign(street.data(), street.size());
+		_city  .assign(city.data(), city.size());
+		_state = state;
+		_zip   = zip;
+		forgetHash();
+
+		return *this;
 	}
 
 	/***********************
@@ -263,57 +350,46 @@ namespace Addresses {
 	**********************/
 	// << operator overload
 	std::ostream & operator<< (std::ostream & s, const Address & address) {
-		// construct the string from each field
-		s << address.street() <<
-			Address::FIELD_SEPARATOR <<
-			address.city() <<
-			Address::FIELD_SEPARATOR <<
-			address.state() <<
-			Address::FIELD_SEPARATOR <<
-			address.zipCode() <<
-			Address::RECORD_SEPARATOR;
-
-		return s;
+		// write the record built from each field
+		return Utilities::Records::write(s, address);
 	}
 
 	// >> operator overload
 	std::istream & operator>> (std::istream & s, Address & address) {
-		using StateCodeException = Address::StateCodeException;
-		using ZipCodeException = Address::ZipCodeException;
-
 		// record string
 		std::string record;
 
-		// get the record from the stream
+		// get the record from the stream and construct the object from the supplied data
 		if (std::getline(s, record, Address::RECORD_SEPARATOR)) {
-			try {
-				// convert record to stream and extract each piece
-				std::stringstream ss(record);
-				std::string street;
-				std::string city;
-				std::string state;
-				std::string zip;
-
-				// get the data from the stream, using the appropriate delimiter
-				std::getline(ss, street, Address::FIELD_SEPARATOR);
-				std::getline(ss, city, Address::FIELD_SEPARATOR);
-				std::getline(ss, state, Address::FIELD_SEPARATOR);
-				std::getline(ss, zip, Address::FIELD_SEPARATOR);
-
-				// construct the object from the supplied data
-				address = Address(street, city, state, zip);
-			}
-			catch (StateCodeException & ex) {
-				throw StateCodeException(ex, "", __LINE__, __func__, __FILE__);
-			}
-			catch (ZipCodeException & ex) {
-				throw ZipCodeException(ex, "", __LINE__, __func__, __FILE__);
-			}
+			fromRecord(record, address);
 		}
 
 		return s;
 	}
 
+	// record overload
+	bool fromRecord(Utilities::StringView record, Address & address) {
+		return fromRecord(Utilities::Records::split(record), address);
+	}
+	bool fromRecord(const Utilities::Records::Fields & fields, Address & address) {
+		if (fields.count == 0) {
+			return false;
+		}
+
+		const Address::Error error = tryFromRecord(fields, address);
+		if (error != Address::Error::NONE) {
+			Address::raise(error, __LINE__, __func__, __FILE__);
+		}
+
+		return true;
+	}
+	Address::Error tryFromRecord(const Utilities::Records::Fields & fields, Address & address) {
+		if (fields.count == 0) {
+			return Address::Error::EMPTY_RECORD;
+		}
+		return Address::tryMake(fields.field[0], fields.field[1], fields.field[2], fields.field[3], address);
+	}
+
 	// pointer stream overloads
 	std::ostream & operator<< (std::ostream & s, const Address * address) {
 		if (address != nullptr) {
@@ -332,13 +408,19 @@ namespace Addresses {
 
 	/***********************
 	 * comparison operators
+	 *
+	 * Addresses are ordered by state, then city, then 5 digit zip code,
+	 * then street - the same fields operator== compares.  State ordinals
+	 * order the same as state names and packed zip codes order the same
+	 * as zip code strings, so states and zip codes are compared as
+	 * integers without building any strings.
 	 **********************/
 	// equals
 	bool operator==(const Address & lhs, const Address & rhs) {
-		return lhs.state() == rhs.state() &&
-			lhs.city() == rhs.city() &&
-			lhs.zipCode().substr(0,5) == rhs.zipCode().substr(0,5) &&
-			lhs.street() == rhs.street();
+		return lhs._state == rhs._state &&
+			lhs._city == rhs._city &&
+			ZipCode::zip5(lhs._zip) == ZipCode::zip5(rhs._zip) &&
+			lhs._street == rhs._street;
 	}
 
 	// not equal
@@ -346,35 +428,32 @@ namespace Addresses {
 		return !(lhs == rhs);
 	}
 
-	// less than
+	// less than - the first field that differs decides
 	bool operator< (const Address & lhs, const Address & rhs) {
-		return lhs.state() < rhs.state() &&
-			lhs.city() < rhs.city() &&
-			lhs.zipCode().substr(0, 5) < rhs.zipCode().substr(0, 5) &&
-			lhs.street() < rhs.street();
+		if (lhs._state != rhs._state) {
+			return lhs._state < rhs._state;
+		}
+		if (const int city = lhs._city.compare(rhs._city)) {
+			return city < 0;
+		}
+		if (ZipCode::zip5(lhs._zip) != ZipCode::zip5(rhs._zip)) {
+			return ZipCode::zip5(lhs._zip) < ZipCode::zip5(rhs._zip);
+		}
+		return lhs._street < rhs._street;
 	}
 
 	// greater than
 	bool operator> (const Address & lhs, const Address & rhs) {
-		return lhs.state() > rhs.state() &&
-			lhs.city() > rhs.city() &&
-			lhs.zipCode().substr(0, 5) > rhs.zipCode().substr(0, 5) &&
-			lhs.street() > rhs.street();
+		return rhs < lhs;
 	}
 
 	// less than or equal
 	bool operator<=(const Address & lhs, const Address & rhs) {
-		return lhs.state() <= rhs.state() &&
-			lhs.city() <= rhs.city() &&
-			lhs.zipCode().substr(0, 5) <= rhs.zipCode().substr(0, 5) &&
-			lhs.street() <= rhs.street();
+		return !(rhs < lhs);
 	}
 
 	// greater than or equal
 	bool operator>=(const Address & lhs, const Address & rhs) {
-		return lhs.state() >= rhs.state() &&
-			lhs.city() >= rhs.city() &&
-			lhs.zipCode().substr(0, 5) >= rhs.zipCode().substr(0, 5) &&
-			lhs.street() >= rhs.street();
+		return !(lhs < rhs);
 	}
 }
\ No newline at end of file
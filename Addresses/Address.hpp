@@ -25,10 +25,18 @@
 #ifndef ADDRESSES_Address_hpp
 #define ADDRESSES_Address_hpp
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
+#include "Addresses/States.hpp"
+#include "Addresses/ZipCode.hpp"
+#include "Utilities/Binary.hpp"
 #include "Utilities/Exceptions.hpp"
+#include "Utilities/Hash.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/StringView.hpp"
 
 
 
@@ -39,6 +47,7 @@ namespace Addresses
   {
     friend std::ostream & operator<< (std::ostream & s, const Address & address);
     friend std::istream & operator>> (std::istream & s,       Address & address);
+    friend bool           fromRecord  (const Utilities::Records::Fields & fields, Address & address);
 
     friend bool operator==(const Address & lhs, const Address & rhs);
     friend bool operator< (const Address & lhs, const Address & rhs);
@@ -52,6 +61,12 @@ namespace Addresses
       struct   StateCodeException    : AddressExceptions              { using AddressExceptions::AddressExceptions; };  // Inherit base class constructors
       struct   ZipCodeException      : AddressExceptions              { using AddressExceptions::AddressExceptions; };
 
+      // Non-throwing validation results.  The throwing functions throw StateCodeException for the STATE errors and
+      // ZipCodeException for the ZIP errors, with describe(error) as the message.  EMPTY_RECORD is only returned by
+      // tryFromRecord(), for a record that holds nothing to build from.
+      enum class Error : std::uint8_t { NONE, STATE_ABBREVIATION, STATE_NAME, ZIP_CODE, ZIP_CODE_VALUE, EMPTY_RECORD };
+      static const char * describe( Error error ) noexcept;
+
 
       // Constructors and Destructor
       Address             (                  )          = default;
@@ -71,6 +86,14 @@ namespace Addresses
                const std::string &    stateCode,
                      unsigned long    zip );
 
+      // Builds address from the four fields without throwing.  Returns the first error found (state, then zip code), leaving address
+      // unchanged, or Error::NONE.  Bad records cost no more than good ones.
+      static Error tryMake( Utilities::StringView street,
+                            Utilities::StringView city,
+                            Utilities::StringView stateCode,
+                            Utilities::StringView zip,
+                            Address &             address );
+
 
       // Queries
       std::string street    () const noexcept;
@@ -78,33 +101,66 @@ namespace Addresses
       std::string state     () const noexcept;
       std::string zipCode   () const noexcept;
 
+      Utilities::StringView  streetView () const noexcept;   // views of the stored text, valid until the address is modified or
+      Utilities::StringView  cityView   () const noexcept;   // destroyed
+      Utilities::StringView  stateView  () const noexcept;
+
+      States::Ordinal  stateOrdinal  () const noexcept;   // compact forms of state() and zipCode(), compare these instead of the
+      ZipCode::Packed  packedZipCode () const noexcept;   // strings when possible
+
+      std::size_t  hash () const noexcept;   // consistent with operator==, so the +4 isn't hashed.  Computed each time unless built
+                                             // with ADDRESSES_CACHE_HASH, which keeps it until the address is modified.
+
 
       // Conversions
       explicit operator std::string () const;
 
+      // The record operator<< writes (fields separated by FIELD_SEPARATOR, ended by RECORD_SEPARATOR), without a stream or any
+      // temporary strings.  formatTo() returns the record's length, and only writes the record if it fits in size characters.
+      void         appendTo ( std::string & record            ) const;
+      std::size_t  formatTo ( char * buffer, std::size_t size ) const noexcept;
 
-      // Modifiers
+
+      // Binary form (see Utilities/Binary.hpp).  The state and zip code are stored in their compact forms, and are only validated
+      // again on the way in if the reader isn't trusted.  deserialize() leaves the address unchanged if it throws.
+      void        serialize   ( Utilities::Binary::Buffer & buffer ) const;
+      Address &   deserialize ( Utilities::Binary::Reader & reader );
+
+
+      // Modifiers - strings are taken by value and moved into place, so an rvalue argument is never copied
       Address &   street  ( std::string     numbersAndName ) noexcept;
       Address &   city    ( std::string     name           ) noexcept;
       Address &   state   ( std::string     code           );  // Must be a valid two digit code, state name, or standard state abbreviation
       Address &   zipCode ( std::string     code           );  // Zip code rules:  5 digits, not all are zero and not all are nine, optionally followed
       Address &   zipCode ( unsigned long   code           );  //                   by a hyphen and 4 digits, not all are zero and not all are nine.
 
+      Address &   stateOrdinal  ( States::Ordinal  state );     // compact forms, validated the same way as the state and zip code strings
+      Address &   packedZipCode ( ZipCode::Packed  zip   );
+
+      Error       tryState      ( Utilities::StringView  code ) noexcept;  // same as state() and zipCode(), but return the error rather
+      Error       tryZipCode    ( Utilities::StringView  code ) noexcept;  // than throw it.  The address is unchanged unless Error::NONE
+      Error       tryZipCode    ( unsigned long          code ) noexcept;  // is returned.
+
 
 
 
     private:
+      [[noreturn]] static void raise( Error error, int lineNumber, const char * functionName, const char * fileName );
+      void                     forgetHash() noexcept;   // called by every modifier
+
       // Instance attribute (aka object state attributes)
-      std::string   _street;
-      std::string   _city;
-      std::string   _state;
-      std::string   _zip;
+      std::string       _street;
+      std::string       _city;
+      States::Ordinal   _state = States::NONE;     // state() is looked up from the state table
+      ZipCode::Packed   _zip   = ZipCode::NONE;    // zipCode() is formatted on demand
+#ifdef ADDRESSES_CACHE_HASH
+      Utilities::Hash::Cache  _hash;               // opt in:  8 more bytes per address, for callers that hash the same address often
+#endif
 
 
       // Class attributes
-      static constexpr char FIELD_SEPARATOR  = '\x03';  // ETX (End of Text) character
-      static constexpr char RECORD_SEPARATOR = '\x04';  // EOT (End of Transmission) character ('\n' turns out to not be a good choice because data
-                                                        //     files are not then portable between Windows, Unix, and Mac OSs.)
+      static constexpr char FIELD_SEPARATOR  = Utilities::Records::FIELD_SEPARATOR;   // ETX (End of Text) character
+      static constexpr char RECORD_SEPARATOR = Utilities::Records::RECORD_SEPARATOR;  // EOT (End of Transmission) character
   };  // class Address
 
 
@@ -122,5 +178,25 @@ namespace Addresses
   std::istream & operator>> (std::istream & s,       Address & address);
   std::ostream & operator<< (std::ostream & s, const Address * address);
   std::istream & operator>> (std::istream & s,       Address * address);
+
+  // Builds address from the text of one record (without its RECORD_SEPARATOR), exactly as operator>> would after reading it from a
+  // stream.  Returns false, leaving address unchanged, if the record holds nothing to build from.
+  bool fromRecord( Utilities::StringView              record, Address & address );
+  bool fromRecord( const Utilities::Records::Fields & fields, Address & address );   // a record already split into fields
+
+  // Same as fromRecord(), but returns the error rather than throwing it, and Error::EMPTY_RECORD where fromRecord() returns false
+  Address::Error tryFromRecord( const Utilities::Records::Fields & fields, Address & address );
 } // namespace Addresses
+
+
+
+
+namespace std
+{
+  template <>
+  struct hash<Addresses::Address>
+  {
+    std::size_t operator()( const Addresses::Address & address ) const noexcept  { return address.hash(); }
+  };
+} // namespace std
 #endif
@@ -0,0 +1,39 @@
+/**
+ * File: AddressFilter.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of building Bloom filters of addresses.
+ *				The file is framed twice:  once to count the records so the filter can be
+ *				sized, and once to add them.  Framing is several times faster than
+ *				building addresses, so the extra pass costs less than holding every hash
+ *				until the count is known.
+ **/
+
+#include <cstddef>
+#include <string>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressFilter.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+namespace Addresses {
+	Utilities::BloomFilter buildFilter(const std::string & path, double falsePositiveRate) {
+		const Utilities::MappedFile file(path);
+
+		std::size_t records = 0;
+		Utilities::Records::forEachRecord(file.contents(), [&records](Utilities::StringView, const Utilities::Records::Fields &) {
+			++records;
+		});
+
+		Utilities::BloomFilter filter(records, falsePositiveRate);
+		Address address;
+		Utilities::Records::forEachRecord(file.contents(), [&filter, &address](Utilities::StringView, const Utilities::Records::Fields & fields) {
+			if (fromRecord(fields, address)) {
+				filter.insert(address);
+			}
+		});
+		return filter;
+	}
+}
@@ -0,0 +1,36 @@
+/**
+ * File: AddressFilter.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to building Bloom filters of addresses, for
+ *				checking incoming addresses against a large list (e.g. a do not mail list)
+ *				without holding the list in memory.  Addresses are keyed the way
+ *				operator== compares them:  state, city, 5 digit zip code and street.  A
+ *				filter that says "maybe" still needs an exact check; one that says "no"
+ *				is always right.
+ *
+ *				Usage:
+ *				        Utilities::BloomFilter filter = Addresses::buildFilter("do_not_mail.dat", 0.01);
+ *				        filter.save("do_not_mail.bloom");
+ *				        ...
+ *				        if (!filter.mayContain(address))  mail(address);
+ **/
+
+#ifndef ADDRESSES_AddressFilter_hpp
+#define ADDRESSES_AddressFilter_hpp
+
+#include <string>
+
+#include "Utilities/BloomFilter.hpp"
+
+
+
+
+namespace Addresses
+{
+  // A filter holding every address in a file of records (as written by operator<<), sized for the number of records.  Throws the
+  // Address exceptions for a record that isn't valid, and Utilities::MappedFile::MappedFileExceptions if the file can't be read.
+  Utilities::BloomFilter buildFilter( const std::string & path, double falsePositiveRate = 0.01 );
+} // namespace Addresses
+#endif
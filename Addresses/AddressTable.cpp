@@ -0,0 +1,165 @@
+/**
+ * File: AddressTable.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the AddressTable class.
+ **/
+
+#include <string>
+#include <vector>
+
+#include "Addresses/AddressTable.hpp"
+
+namespace Addresses {
+	/**********************
+	* Row
+	**********************/
+	AddressTable::Row::Row(const AddressTable & table, RowId row) noexcept
+		: _table(&table), _row(row) {
+	}
+
+	Utilities::StringView AddressTable::Row::street() const noexcept {
+		return _table->_strings[_table->_streets[_row]];
+	}
+	Utilities::StringView AddressTable::Row::city() const noexcept {
+		return _table->_strings[_table->_cities[_row]];
+	}
+	Utilities::StringView AddressTable::Row::state() const noexcept {
+		const States::Ordinal state = stateOrdinal();
+		return Utilities::StringView(States::name(state), States::nameLength(state));
+	}
+	std::string AddressTable::Row::zipCode() const {
+		char buffer[ZipCode::MAX_LENGTH];
+		return std::string(buffer, ZipCode::format(packedZipCode(), buffer));
+	}
+	States::Ordinal AddressTable::Row::stateOrdinal() const noexcept {
+		return _table->_states[_row];
+	}
+	ZipCode::Packed AddressTable::Row::packedZipCode() const noexcept {
+		return _table->_zips[_row];
+	}
+
+	AddressTable::Row::operator Address() const {
+		const Utilities::StringView streetName = street();
+		const Utilities::StringView cityName   = city();
+
+		Address address;
+		address.street(std::string(streetName.data(), streetName.size()))
+		       .city(std::string(cityName.data(), cityName.size()));
+
+		// rows were validated on the way in, but a default constructed Address has neither
+		if (stateOrdinal() != States::NONE) {
+			address.stateOrdinal(stateOrdinal());
+		}
+		if (packedZipCode() != ZipCode::NONE) {
+			address.packedZipCode(packedZipCode());
+		}
+
+		return address;
+	}
+
+
+	/**********************
+	* Constructors
+	**********************/
+	AddressTable::AddressTable(const std::vector<Address> & addresses) {
+		reserve(addresses.size());
+		for (const auto & address : addresses) {
+			append(address);
+		}
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	std::size_t AddressTable::size() const noexcept {
+		return _states.size();
+	}
+	bool AddressTable::empty() const noexcept {
+		return _states.empty();
+	}
+	AddressTable::Row AddressTable::operator[](RowId row) const noexcept {
+		return Row(*this, row);
+	}
+	Address AddressTable::address(RowId row) const {
+		return static_cast<Address>((*this)[row]);
+	}
+	std::vector<Address> AddressTable::addresses() const {
+		std::vector<Address> result;
+		result.reserve(size());
+		for (RowId row = 0; row < size(); ++row) {
+			result.push_back(address(row));
+		}
+		return result;
+	}
+
+	std::vector<AddressTable::RowId> AddressTable::select(States::Ordinal state, const std::string & zipPrefix) const {
+		std::vector<RowId> rows;
+
+		ZipCode::Packed first;
+		ZipCode::Packed last;
+		if (!ZipCode::prefixRange(zipPrefix.data(), zipPrefix.length(), first, last)) {
+			return rows;
+		}
+
+		// two tight loops over one or two columns; the zip code check is a single unsigned range compare
+		const ZipCode::Packed width = last - first;
+		if (state == States::NONE) {
+			for (RowId row = 0; row < _zips.size(); ++row) {
+				if (_zips[row] - first <= width) {
+					rows.push_back(row);
+				}
+			}
+		}
+		else {
+			for (RowId row = 0; row < _states.size(); ++row) {
+				if (_states[row] == state && _zips[row] - first <= width) {
+					rows.push_back(row);
+				}
+			}
+		}
+		return rows;
+	}
+
+	const std::vector<Utilities::StringPool::Id> & AddressTable::streetIds() const noexcept {
+		return _streets;
+	}
+	const std::vector<Utilities::StringPool::Id> & AddressTable::cityIds() const noexcept {
+		return _cities;
+	}
+	const std::vector<States::Ordinal> & AddressTable::states() const noexcept {
+		return _states;
+	}
+	const std::vector<ZipCode::Packed> & AddressTable::zipCodes() const noexcept {
+		return _zips;
+	}
+	const Utilities::StringPool & AddressTable::strings() const noexcept {
+		return _strings;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	AddressTable::RowId AddressTable::append(const Address & address) {
+		_streets.push_back(_strings.intern(address.streetView()));
+		_cities .push_back(_strings.intern(address.cityView()));
+		_states .push_back(address.stateOrdinal());
+		_zips   .push_back(address.packedZipCode());
+
+		return size() - 1;
+	}
+
+	void AddressTable::reserve(std::size_t rows) {
+		_streets.reserve(rows);
+		_cities .reserve(rows);
+		_states .reserve(rows);
+		_zips   .reserve(rows);
+	}
+
+	void AddressTable::clear() {
+		*this = AddressTable();
+	}
+}
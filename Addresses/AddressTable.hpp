@@ -0,0 +1,110 @@
+/**
+ * File: AddressTable.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the AddressTable class, a column oriented
+ *				(struct of arrays) container of addresses.  Streets and cities are interned
+ *				in one shared StringPool and stored as dictionary Ids, states are stored as
+ *				one byte ordinals and zip codes as packed integers.  A scan only touches the
+ *				columns it needs.
+ **/
+
+#ifndef ADDRESSES_AddressTable_hpp
+#define ADDRESSES_AddressTable_hpp
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/States.hpp"
+#include "Addresses/ZipCode.hpp"
+#include "Utilities/StringPool.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Addresses
+{
+  class AddressTable
+  {
+    public:
+      using RowId = std::size_t;
+
+
+      // A lightweight, read only view of one row:  the table's address and a RowId, read through on every call.  A Row, and the
+      // street and city views it returns (the string pool never moves its text), stay valid as rows are appended.  They are
+      // invalidated when the table is destroyed, cleared, moved from or assigned to.
+      class Row
+      {
+        public:
+          Utilities::StringView   street        () const noexcept;
+          Utilities::StringView   city          () const noexcept;
+          Utilities::StringView   state         () const noexcept;
+          std::string             zipCode       () const;
+          States::Ordinal         stateOrdinal  () const noexcept;
+          ZipCode::Packed         packedZipCode () const noexcept;
+
+          explicit operator Address () const;          // materialize the row as an Address object
+
+
+        private:
+          friend class AddressTable;
+          Row( const AddressTable & table, RowId row ) noexcept;
+
+          const AddressTable *  _table;
+          RowId                 _row;
+      };
+
+
+      // Constructors and Destructor
+      AddressTable             (                        )          = default;
+      AddressTable             ( const AddressTable &   )          = default;
+      AddressTable             (       AddressTable &&  )          = default;
+      AddressTable & operator= ( const AddressTable &   )          = default;
+      AddressTable & operator= (       AddressTable &&  )          = default;
+     ~AddressTable             (                        ) noexcept = default;
+
+      explicit AddressTable( const std::vector<Address> & addresses );
+
+
+      // Queries
+      std::size_t           size       (             ) const noexcept;
+      bool                  empty      (             ) const noexcept;
+      Row                   operator[] ( RowId row   ) const noexcept;
+      Address               address    ( RowId row   ) const;
+      std::vector<Address>  addresses  (             ) const;          // every row as an Address, in row order
+
+      // Scans - the rows in state (any state if States::NONE) whose zip code starts with zipPrefix (e.g. "926"), in row order.
+      // Only the state and zip code columns are read.  Returns no rows if zipPrefix is not 0 to 5 digits.
+      std::vector<RowId>    select     ( States::Ordinal state, const std::string & zipPrefix = {} ) const;
+
+
+      // Column access, indexed by RowId.  Street and city Ids index strings().
+      const std::vector<Utilities::StringPool::Id> &  streetIds () const noexcept;
+      const std::vector<Utilities::StringPool::Id> &  cityIds   () const noexcept;
+      const std::vector<States::Ordinal> &            states    () const noexcept;
+      const std::vector<ZipCode::Packed> &            zipCodes  () const noexcept;
+      const Utilities::StringPool &                   strings   () const noexcept;
+
+
+      // Modifiers
+      RowId                 append     ( const Address & address );
+      void                  reserve    ( std::size_t rows );
+      void                  clear      (             );
+
+
+
+
+    private:
+      // Instance attribute (aka object state attributes)
+      Utilities::StringPool                    _strings;    // streets and cities share one dictionary
+      std::vector<Utilities::StringPool::Id>   _streets;
+      std::vector<Utilities::StringPool::Id>   _cities;
+      std::vector<States::Ordinal>             _states;
+      std::vector<ZipCode::Packed>             _zips;
+  };  // class AddressTable
+} // namespace Addresses
+#endif
@@ -0,0 +1,57 @@
+/**
+ * File: AddressValidation.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of batch address validation.
+ **/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Addresses/AddressValidation.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+namespace Addresses {
+	/**********************
+	* Report queries
+	**********************/
+	std::size_t ValidationReport::valid() const noexcept {
+		return records - rejections.size();
+	}
+
+	std::size_t ValidationReport::count(Address::Error error) const noexcept {
+		return static_cast<std::size_t>(std::count_if(rejections.begin(), rejections.end(),
+			[error](const Rejection & rejection) { return rejection.error == error; }));
+	}
+
+
+	/**********************
+	* Batch validation
+	**********************/
+	ValidationReport validateRecords(Utilities::StringView text, std::vector<Address> * valid) {
+		ValidationReport report;
+
+		// one scratch address is reused, so its strings keep their capacity from record to record
+		Address address;
+		Utilities::Records::forEachRecord(text, [&](Utilities::StringView, const Utilities::Records::Fields & fields) {
+			// blank records are skipped, as loadAll() skips them
+			if (fields.count == 0) {
+				return;
+			}
+
+			const Address::Error error = tryFromRecord(fields, address);
+			if (error != Address::Error::NONE) {
+				report.rejections.push_back({ static_cast<std::uint32_t>(report.records), error });
+			}
+			else if (valid != nullptr) {
+				valid->push_back(address);
+			}
+			++report.records;
+		});
+
+		return report;
+	}
+}
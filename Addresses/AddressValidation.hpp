@@ -0,0 +1,55 @@
+/**
+ * File: AddressValidation.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to batch address validation.  A whole buffer
+ *				of address records is checked without throwing, and the bad records are
+ *				listed in a compact report (record number and error code) rather than
+ *				one exception each.
+ *
+ *				Usage:
+ *				        std::vector<Addresses::Address> good;
+ *				        const auto report = Addresses::validateRecords(file.contents(), &good);
+ *				        for (const auto & rejection : report.rejections)
+ *				          std::cerr << rejection.record << ": " << Addresses::Address::describe(rejection.error) << '\n';
+ **/
+
+#ifndef ADDRESSES_AddressValidation_hpp
+#define ADDRESSES_AddressValidation_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Addresses
+{
+  struct ValidationReport
+  {
+    struct Rejection
+    {
+      std::uint32_t    record;     // zero based position of the record in the text, not counting blank records
+      Address::Error   error;
+    };
+
+    std::size_t              records = 0;     // records examined, blank records aren't
+    std::vector<Rejection>   rejections;      // one per bad record, in record order
+
+    std::size_t  valid () const noexcept;                      // records that passed
+    std::size_t  count ( Address::Error error ) const noexcept; // rejections with this error
+  };
+
+
+
+
+  // Validates every record of text (records as written by operator<<) with the same rules as operator>>, but never throws a
+  // validation error.  Good records are appended to valid, in order, if valid isn't nullptr.  Blank records are skipped.
+  ValidationReport validateRecords( Utilities::StringView text, std::vector<Address> * valid = nullptr );
+} // namespace Addresses
+#endif
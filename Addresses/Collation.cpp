@@ -0,0 +1,136 @@
+/**
+ * File: Collation.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of address collation.
+ **/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Addresses/Collation.hpp"
+#include "Utilities/StringView.hpp"
+
+namespace Addresses {
+	namespace Collation {
+		namespace {
+			// the rank of each distinct string among all of them, indexed by the position of the string in distinct
+			std::vector<std::uint32_t> rankDistinct(const std::vector<Utilities::StringView> & distinct) {
+				std::vector<std::uint32_t> byText(distinct.size());
+				std::iota(byText.begin(), byText.end(), 0);
+				std::sort(byText.begin(), byText.end(), [&distinct](std::uint32_t lhs, std::uint32_t rhs) {
+					return distinct[lhs] < distinct[rhs];
+				});
+
+				std::vector<std::uint32_t> ranks(distinct.size());
+				for (std::uint32_t rank = 0; rank < byText.size(); ++rank) {
+					ranks[byText[rank]] = rank;
+				}
+				return ranks;
+			}
+
+			// the rank of each string among the distinct strings, so equal strings get equal ranks.  Only the distinct strings are sorted.
+			std::vector<std::uint32_t> rank(const std::vector<Utilities::StringView> & strings) {
+				std::unordered_map<Utilities::StringView, std::uint32_t> ids;
+				std::vector<Utilities::StringView> distinct;
+				std::vector<std::uint32_t> result(strings.size());
+
+				for (std::size_t i = 0; i < strings.size(); ++i) {
+					const auto id = ids.emplace(strings[i], static_cast<std::uint32_t>(distinct.size()));
+					if (id.second) {
+						distinct.push_back(strings[i]);
+					}
+					result[i] = id.first->second;
+				}
+
+				const std::vector<std::uint32_t> ranks = rankDistinct(distinct);
+				for (auto & id : result) {
+					id = ranks[id];
+				}
+				return result;
+			}
+
+			inline Key makeKey(States::Ordinal state, std::uint32_t city, ZipCode::Packed zip, std::uint32_t street, std::size_t index) noexcept {
+				return {
+					(static_cast<std::uint64_t>(state) << 56) | (static_cast<std::uint64_t>(city) << 24) | ZipCode::zip5(zip),
+					(static_cast<std::uint64_t>(street) << 32) | static_cast<std::uint32_t>(index)
+				};
+			}
+		}
+
+		/**********************
+		* Keys
+		**********************/
+		std::vector<Key> keys(const std::vector<Address> & addresses) {
+			std::vector<Utilities::StringView> cities;
+			std::vector<Utilities::StringView> streets;
+			cities.reserve(addresses.size());
+			streets.reserve(addresses.size());
+			for (const auto & address : addresses) {
+				cities.push_back(address.cityView());
+				streets.push_back(address.streetView());
+			}
+
+			const std::vector<std::uint32_t> cityRanks   = rank(cities);
+			const std::vector<std::uint32_t> streetRanks = rank(streets);
+
+			std::vector<Key> result;
+			result.reserve(addresses.size());
+			for (std::size_t i = 0; i < addresses.size(); ++i) {
+				result.push_back(makeKey(addresses[i].stateOrdinal(), cityRanks[i], addresses[i].packedZipCode(), streetRanks[i], i));
+			}
+			return result;
+		}
+
+		std::vector<Key> keys(const AddressTable & table) {
+			// the pool's strings are already distinct; streets and cities share it, which doesn't change their relative order
+			const Utilities::StringPool & pool = table.strings();
+			std::vector<Utilities::StringView> distinct;
+			distinct.reserve(pool.size());
+			for (Utilities::StringPool::Id id = 0; id < pool.size(); ++id) {
+				distinct.push_back(pool[id]);
+			}
+			const std::vector<std::uint32_t> ranks = rankDistinct(distinct);
+
+			std::vector<Key> result;
+			result.reserve(table.size());
+			for (std::size_t row = 0; row < table.size(); ++row) {
+				result.push_back(makeKey(table.states()[row], ranks[table.cityIds()[row]], table.zipCodes()[row], ranks[table.streetIds()[row]], row));
+			}
+			return result;
+		}
+
+
+		/**********************
+		* Sorting
+		**********************/
+		std::vector<std::size_t> order(std::vector<Key> & keys) {
+			std::sort(keys.begin(), keys.end());
+
+			std::vector<std::size_t> indexes;
+			indexes.reserve(keys.size());
+			for (const auto & key : keys) {
+				indexes.push_back(key.index());
+			}
+			return indexes;
+		}
+
+		void sort(std::vector<Address> & addresses) {
+			std::vector<Key> sortKeys = keys(addresses);
+			const std::vector<std::size_t> indexes = order(sortKeys);
+
+			std::vector<Address> sorted;
+			sorted.reserve(addresses.size());
+			for (const std::size_t index : indexes) {
+				sorted.push_back(std::move(addresses[index]));
+			}
+			addresses = std::move(sorted);
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/**
+ * File: Collation.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to address collation:  fixed size binary sort
+ *				keys that order exactly the same as Addresses::operator< (state, city,
+ *				5 digit zip code, street).  Keys are built once for a whole collection -
+ *				each distinct city and street is ranked by sorting just the distinct
+ *				strings - so sorting the collection compares pairs of integers instead of
+ *				strings.
+ *
+ *				Usage:
+ *				        std::vector<Addresses::Address> addresses = ...;
+ *				        Addresses::Collation::sort(addresses);
+ **/
+
+#ifndef ADDRESSES_Collation_hpp
+#define ADDRESSES_Collation_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressTable.hpp"
+
+
+
+
+namespace Addresses
+{
+  namespace Collation
+  {
+    // The sort key of record number index() of a collection, packed with the index so sorting keys alone sorts (key, index)
+    // pairs.  Layout, most significant bits first:
+    //
+    //        high:   state ordinal (8)   city rank (32)   zip5 (24)
+    //        low:    street rank (32)    record index (32)
+    //
+    // Keys of equal addresses differ only in the index, so sorting keys is stable.
+    struct Key
+    {
+      std::uint64_t   high;
+      std::uint64_t   low;
+
+      std::uint32_t   index       () const noexcept  { return static_cast<std::uint32_t>( low ); }
+      bool            sameAddress ( const Key & rhs ) const noexcept  { return high == rhs.high  &&  ( low >> 32 ) == ( rhs.low >> 32 ); }
+    };
+
+    inline bool operator< ( const Key & lhs, const Key & rhs ) noexcept
+    {
+      return lhs.high < rhs.high  ||  ( lhs.high == rhs.high  &&  lhs.low < rhs.low );
+    }
+
+
+    // One key per record, in record order.  Collections must have fewer than 2^32 records.
+    std::vector<Key>          keys  ( const std::vector<Address> & addresses );
+    std::vector<Key>          keys  ( const AddressTable &         table     );
+
+    // The record indexes in sorted order.  keys is sorted in place.
+    std::vector<std::size_t>  order ( std::vector<Key> & keys );
+
+    // Stable sort by operator<
+    void                      sort  ( std::vector<Address> & addresses );
+  } // namespace Collation
+} // namespace Addresses
+#endif
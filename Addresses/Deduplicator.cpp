@@ -0,0 +1,237 @@
+/**
+ * File: Deduplicator.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the Deduplicator class.  A
+ *				spill file holds entries in arrival order, each a flag byte (SEEN or
+ *				CANDIDATE) followed by an address in the binary record format.  The
+ *				partition's set goes first, as SEEN entries, so replaying the file into a
+ *				new Deduplicator decides every candidate exactly as this one would have.
+ **/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "Addresses/Deduplicator.hpp"
+#include "Utilities/MappedFile.hpp"
+
+namespace Addresses {
+	namespace {
+		constexpr std::uint8_t SEEN      = 0;
+		constexpr std::uint8_t CANDIDATE = 1;
+
+		constexpr std::size_t MIN_BUFFER  = 1024;         // pending bytes per spilled partition, whatever the budget
+		constexpr std::size_t MAX_BUFFER  = 64 * 1024;
+
+		// a set node:  the address, the next pointer and cached hash, a bucket, and the text the strings allocate
+		inline std::size_t cost(const Address & address) noexcept {
+			return sizeof(Address) + 3 * sizeof(void *) + address.streetView().size() + address.cityView().size();
+		}
+
+		// the most a spill file entry can take:  the flag, the record header, state, zip code and the strings with their lengths
+		inline std::size_t entrySize(const Address & address) noexcept {
+			return 32 + address.streetView().size() + address.cityView().size();
+		}
+	}
+
+	/**********************
+	* Constructors and Destructor
+	**********************/
+	Deduplicator::Deduplicator(Emit emit)
+		: Deduplicator(std::move(emit), Options(), 0) {
+	}
+
+	Deduplicator::Deduplicator(Emit emit, Options options)
+		: Deduplicator(std::move(emit), std::move(options), 0) {
+	}
+
+	Deduplicator::Deduplicator(Emit emit, Options options, unsigned level)
+		: _emit(std::move(emit)), _options(std::move(options)), _level(level), _bits(1), _partitions(std::max<std::size_t>(_options.partitions, 1)) {
+		while (_bits < 32 && (std::size_t{ 1 } << _bits) < _partitions.size()) {
+			++_bits;
+		}
+		// all the buffers together take at most a quarter of the budget, so spilling always frees more than it costs
+		_bufferSize = std::min(std::max(_options.memoryBudget / (4 * _partitions.size()), MIN_BUFFER), MAX_BUFFER);
+
+		std::random_device random;
+		std::ostringstream name;
+		name << std::hex << random() << random();
+		_name = name.str();
+	}
+
+	Deduplicator::~Deduplicator() noexcept {
+		for (std::size_t partition = 0; partition < _partitions.size(); ++partition) {
+			if (_partitions[partition].spilled) {
+				std::remove(path(partition).c_str());
+			}
+		}
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	const Deduplicator::Statistics & Deduplicator::statistics() const noexcept {
+		return _statistics;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	void Deduplicator::insert(const Address & address) {
+		++_statistics.records;
+		add(address, true);
+	}
+
+	void Deduplicator::remember(const Address & address) {
+		add(address, false);
+	}
+
+	void Deduplicator::finish() {
+		// free everything held in memory first, so each replay has the whole budget
+		for (std::size_t index = 0; index < _partitions.size(); ++index) {
+			Partition & partition = _partitions[index];
+			if (partition.spilled) {
+				flush(index);
+				partition.pending = Utilities::Binary::Buffer();
+			}
+			std::unordered_set<Address>().swap(partition.seen);
+			partition.bytes = 0;
+		}
+		_bytes = 0;
+
+		for (std::size_t index = 0; index < _partitions.size(); ++index) {
+			Partition & partition = _partitions[index];
+			if (!partition.spilled) {
+				continue;
+			}
+
+			// replay the partition in arrival order, partitioned by other hash bits in case it still doesn't fit
+			Deduplicator replay(_emit, _options, _level + 1);
+			{
+				const Utilities::MappedFile file(path(index));
+				Utilities::Binary::Reader reader(file.contents(), true);
+				Address address;
+				while (!reader.atEnd()) {
+					const bool candidate = reader.get8() == CANDIDATE;
+					replay.add(address.deserialize(reader), candidate);
+				}
+			}
+			std::remove(path(index).c_str());
+			partition.spilled = false;
+
+			replay.finish();
+			_statistics.unique     += replay._statistics.unique;
+			_statistics.duplicates += replay._statistics.duplicates;
+			_statistics.spills     += replay._statistics.spills;
+			_statistics.spillBytes += replay._statistics.spillBytes;
+			_statistics.peakBytes   = std::max(_statistics.peakBytes, replay._statistics.peakBytes);
+		}
+	}
+
+
+	/**********************
+	* Partitions
+	**********************/
+	void Deduplicator::add(const Address & address, bool candidate) {
+		const std::size_t index = partitionOf(address);
+		Partition & partition = _partitions[index];
+
+		// undecided until finish()
+		if (partition.spilled) {
+			if (partition.pending.size() + entrySize(address) > _bufferSize) {
+				flush(index);
+			}
+			partition.pending.put8(candidate ? CANDIDATE : SEEN);
+			address.serialize(partition.pending);
+			return;
+		}
+
+		if (!partition.seen.insert(address).second) {
+			if (candidate) {
+				++_statistics.duplicates;
+			}
+			return;
+		}
+		if (candidate) {
+			++_statistics.unique;
+			_emit(address);
+		}
+
+		partition.bytes += cost(address);
+		_bytes += cost(address);
+		while (_bytes > _options.memoryBudget) {
+			if (!spill()) {
+				break;
+			}
+		}
+		_statistics.peakBytes = std::max(_statistics.peakBytes, _bytes);
+	}
+
+	// multiply-shift maps 32 bits of the hash evenly onto any number of partitions.  Only the top _bits of them really decide
+	// the partition, so each level rotates the hash by that many to partition by bits no earlier level has used.
+	std::size_t Deduplicator::partitionOf(const Address & address) const noexcept {
+		const std::uint64_t hash = address.hash();
+		const unsigned shift = _bits * _level;
+		const std::uint64_t rotated = shift == 0 ? hash : (hash << shift) | (hash >> (64 - shift));
+		return static_cast<std::size_t>(((rotated >> 32) * _partitions.size()) >> 32);
+	}
+
+	// writes out the largest partition still in memory, keeping a buffer for what arrives later
+	bool Deduplicator::spill() {
+		if ((_level + 2) * _bits > 64) {
+			return false;  // a replay would have no unused hash bits left; the addresses that remain can only be held in memory
+		}
+
+		const auto largest = std::max_element(_partitions.begin(), _partitions.end(), [](const Partition & lhs, const Partition & rhs) {
+			return lhs.bytes < rhs.bytes;
+		});
+		if (largest->bytes <= _bufferSize) {
+			return false;  // spilling would free no more than its buffer takes
+		}
+		const std::size_t index = static_cast<std::size_t>(largest - _partitions.begin());
+		Partition & partition = *largest;
+
+		std::ofstream(path(index), std::ios::binary | std::ios::trunc);   // start empty, then append
+		partition.spilled = true;
+		partition.pending.reserve(_bufferSize);
+		_bytes += _bufferSize;
+		for (const auto & address : partition.seen) {
+			if (partition.pending.size() + entrySize(address) > _bufferSize) {
+				flush(index);
+			}
+			partition.pending.put8(SEEN);
+			address.serialize(partition.pending);
+		}
+		flush(index);
+
+		std::unordered_set<Address>().swap(partition.seen);
+		_bytes -= partition.bytes;
+		partition.bytes = 0;
+		++_statistics.spills;
+		return true;
+	}
+
+	void Deduplicator::flush(std::size_t index) {
+		Utilities::Binary::Buffer & pending = _partitions[index].pending;
+
+		std::ofstream file(path(index), std::ios::binary | std::ios::app);
+		if (!file.write(pending.data(), static_cast<std::streamsize>(pending.size()))) {
+			throw DeduplicatorExceptions("Unable to write \"" + path(index) + '"', __LINE__, __func__, __FILE__);
+		}
+		_statistics.spillBytes += pending.size();
+		pending.clear();
+	}
+
+	std::string Deduplicator::path(std::size_t partition) const {
+		return _options.tempDirectory + "/dedup-" + _name + '-' + std::to_string(partition);
+	}
+}
@@ -0,0 +1,129 @@
+/**
+ * File: Deduplicator.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the Deduplicator class, a pipeline stage
+ *				that passes on the first occurrence of each address in a stream and drops
+ *				the rest.  Addresses are the same if operator== says so (state, city,
+ *				5 digit zip code and street); the first occurrence is the one passed on,
+ *				+4 and all.
+ *
+ *				Addresses seen so far are kept in hash sets, one per partition of the hash
+ *				values.  When they outgrow the memory budget the largest partition is
+ *				spilled:  its set is written to a temporary file and later addresses that
+ *				fall in that partition are buffered and appended to the file undecided.
+ *				The buffers count against the budget too.  finish() frees the sets still in
+ *				memory, then deduplicates each spilled partition on its own, with a new
+ *				Deduplicator that partitions by other hash bits, so a spilled partition
+ *				that still doesn't fit is spilled again.  Addresses in spilled partitions
+ *				are therefore passed on by finish(), after the others, in input order
+ *				within each partition.  Only once every hash bit has been used (after
+ *				about 64 / log2(partitions) levels) can the budget be exceeded.
+ *
+ *				Usage:
+ *				        Addresses::Deduplicator dedup([&](const Addresses::Address & address) { output << address; });
+ *				        for (const auto & address : doNotMail)  dedup.remember(address);
+ *				        for (const auto & address : feed)       dedup.insert(address);
+ *				        dedup.finish();
+ *				        std::cout << dedup.statistics().duplicates << " duplicates removed\n";
+ **/
+
+#ifndef ADDRESSES_Deduplicator_hpp
+#define ADDRESSES_Deduplicator_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Utilities/Binary.hpp"
+#include "Utilities/Exceptions.hpp"
+
+
+
+
+namespace Addresses
+{
+  class Deduplicator
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct DeduplicatorExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // a spill file can't be written
+
+      using Emit = std::function<void ( const Address & address )>;
+
+      struct Options
+      {
+        std::size_t   memoryBudget  = 256 * 1024 * 1024;   // approximate bytes of addresses held in memory at once
+        std::string   tempDirectory = ".";                 // where spilled partitions are written, on a local filesystem
+        std::size_t   partitions    = 64;
+      };
+
+      struct Statistics
+      {
+        std::size_t     records     = 0;     // addresses inserted
+        std::size_t     unique      = 0;     // passed on
+        std::size_t     duplicates  = 0;     // dropped, including ones matching a remembered address
+        std::size_t     spills      = 0;     // partitions written to disk, at every level
+        std::uint64_t   spillBytes  = 0;
+        std::size_t     peakBytes   = 0;     // most memory held at once by the sets and spill buffers, at any level
+      };
+
+
+      // Constructors and Destructor
+      Deduplicator             ( const Deduplicator &  )          = delete;
+      Deduplicator             (       Deduplicator && )          = delete;
+      Deduplicator & operator= ( const Deduplicator &  )          = delete;
+      Deduplicator & operator= (       Deduplicator && )          = delete;
+     ~Deduplicator             (                       ) noexcept;   // removes any spill files left
+
+      explicit Deduplicator( Emit emit );                    // default Options
+               Deduplicator( Emit emit, Options options );
+
+
+      // Queries
+      const Statistics &  statistics () const noexcept;   // complete after finish()
+
+
+      // Modifiers
+      void  insert   ( const Address & address );   // passes address on (now or in finish()) if it's the first occurrence
+      void  remember ( const Address & address );   // counts address as seen without passing it on, e.g. a do not mail list
+      void  finish   ();                            // passes on the addresses in spilled partitions; nothing may be added after
+
+
+
+
+    private:
+      struct Partition
+      {
+        std::unordered_set<Address>  seen;
+        std::size_t                  bytes   = 0;     // estimated memory held by seen
+        bool                         spilled = false;
+        Utilities::Binary::Buffer    pending;         // entries not yet appended to the spill file, at most _bufferSize bytes
+      };
+
+      Deduplicator( Emit emit, Options options, unsigned level );
+
+      void         add         ( const Address & address, bool candidate );
+      std::size_t  partitionOf ( const Address & address ) const noexcept;
+      bool         spill       ();                             // false if nothing could be spilled
+      void         flush       ( std::size_t partition );
+      std::string  path        ( std::size_t partition ) const;
+
+      // Instance attribute (aka object state attributes)
+      Emit                     _emit;
+      Options                  _options;
+      unsigned                 _level;          // picks the hash bits used for partitioning
+      unsigned                 _bits;           // hash bits each level uses, enough to tell the partitions apart
+      std::size_t              _bufferSize;     // pending bytes per spilled partition before they're appended to its file
+      std::string              _name;           // makes spill file names unique
+      std::vector<Partition>   _partitions;
+      std::size_t              _bytes = 0;
+      Statistics               _statistics;
+  };  // class Deduplicator
+} // namespace Addresses
+#endif
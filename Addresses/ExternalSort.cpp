@@ -0,0 +1,328 @@
+/**
+ * File: ExternalSort.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the external address sort.  Runs are
+ *				sorted with Collation::sort (stable, operator< order) and written in the
+ *				binary record format so merging doesn't re-parse or re-validate text.  Each
+ *				run file is read through its own buffer; the buffers share what the memory
+ *				budget allows.
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/Collation.hpp"
+#include "Addresses/ExternalSort.hpp"
+#include "Utilities/Binary.hpp"
+#include "Utilities/LoserTree.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+namespace Addresses {
+	namespace ExternalSort {
+		namespace {
+			using Clock = std::chrono::steady_clock;
+
+			constexpr std::size_t MIN_BUFFER = 64 * 1024;
+			constexpr std::size_t MAX_BUFFER = 4 * 1024 * 1024;
+			constexpr std::size_t MAX_FAN_IN = 256;               // runs open at once by default, well under the usual 1024 file limit
+
+			// memory a record costs beyond its text:  the address, the copy Collation::sort moves it into, its key and ranking tables
+			constexpr std::size_t RECORD_OVERHEAD = 2 * sizeof(Address) + sizeof(Collation::Key) + 64;
+
+			double since(Clock::time_point start) {
+				return std::chrono::duration<double>(Clock::now() - start).count();
+			}
+
+			// a buffer's share of the budget, split between sources input buffers and one output buffer
+			std::size_t bufferSize(std::size_t budget, std::size_t sources) {
+				return std::min(std::max(budget / (sources + 1), MIN_BUFFER), MAX_BUFFER);
+			}
+
+
+			// Names the run files, and removes any that are left when the sort finishes or throws
+			class RunFiles {
+			public:
+				RunFiles(const std::string & directory, const std::string & output) {
+					const std::size_t slash = output.find_last_of("/\\");
+					_prefix = directory + '/' + (slash == std::string::npos ? output : output.substr(slash + 1)) + ".run";
+				}
+				RunFiles(const RunFiles &) = delete;
+				RunFiles & operator= (const RunFiles &) = delete;
+				~RunFiles() noexcept {
+					for (const auto & path : _paths) {
+						std::remove(path.c_str());
+					}
+				}
+
+				const std::string & create() {
+					_paths.push_back(_prefix + std::to_string(_paths.size()));
+					return _paths.back();
+				}
+
+			private:
+				std::string _prefix;
+				std::vector<std::string> _paths;
+			};
+
+
+			// Writes addresses to a file as text records or as binary records, a buffer at a time
+			class RecordWriter {
+			public:
+				RecordWriter(const std::string & path, std::size_t bufferSize, bool binary)
+					: _file(path, std::ios::binary | std::ios::trunc), _path(path), _bufferSize(bufferSize), _binary(binary) {
+					if (!_file) {
+						throw FileException("Unable to create \"" + path + '"', __LINE__, __func__, __FILE__);
+					}
+					if (_binary) {
+						_records.reserve(bufferSize);
+					}
+					else {
+						_text.reserve(bufferSize);
+					}
+				}
+
+				void put(const Address & address) {
+					if (_binary) {
+						address.serialize(_records);
+						if (_records.size() >= _bufferSize) {
+							write(_records.data(), _records.size());
+							_records.clear();
+						}
+					}
+					else {
+						address.appendTo(_text);
+						if (_text.size() >= _bufferSize) {
+							write(_text.data(), _text.size());
+							_text.clear();
+						}
+					}
+				}
+
+				// flushes and closes the file, returns the bytes written
+				std::uint64_t finish() {
+					write(_records.data(), _records.size());
+					write(_text.data(), _text.size());
+					_file.close();
+					if (!_file) {
+						throw FileException("Unable to write \"" + _path + '"', __LINE__, __func__, __FILE__);
+					}
+					return _written;
+				}
+
+			private:
+				void write(const char * data, std::size_t size) {
+					if (!_file.write(data, static_cast<std::streamsize>(size))) {
+						throw FileException("Unable to write \"" + _path + '"', __LINE__, __func__, __FILE__);
+					}
+					_written += size;
+				}
+
+				std::ofstream _file;
+				std::string _path;
+				std::size_t _bufferSize;
+				bool _binary;
+				std::string _text;
+				Utilities::Binary::Buffer _records;
+				std::uint64_t _written = 0;
+			};
+
+
+			// Reads the addresses of a run file back in order, a buffer at a time
+			class RunReader {
+			public:
+				RunReader(const std::string & path, std::size_t bufferSize)
+					: _file(path, std::ios::binary), _path(path), _buffer(bufferSize) {
+					if (!_file) {
+						throw FileException("Unable to open \"" + path + '"', __LINE__, __func__, __FILE__);
+					}
+				}
+
+				// false at the end of the run
+				bool next(Address & address) {
+					if (!fill(Utilities::Binary::HEADER_SIZE)) {
+						if (_begin != _end) {
+							throw FileException("Truncated run file \"" + _path + '"', __LINE__, __func__, __FILE__);
+						}
+						return false;
+					}
+
+					Utilities::Binary::Reader header(Utilities::StringView(_buffer.data() + _begin, Utilities::Binary::HEADER_SIZE));
+					header.get8();
+					header.get8();
+					const std::size_t size = Utilities::Binary::HEADER_SIZE + header.get32();
+					if (!fill(size)) {
+						throw FileException("Truncated run file \"" + _path + '"', __LINE__, __func__, __FILE__);
+					}
+
+					// the run was written from addresses already validated
+					Utilities::Binary::Reader record(Utilities::StringView(_buffer.data() + _begin, size), true);
+					address.deserialize(record);
+					_begin += size;
+					return true;
+				}
+
+			private:
+				// makes at least bytes unread bytes available, false if the file ends first
+				bool fill(std::size_t bytes) {
+					if (_end - _begin >= bytes) {
+						return true;
+					}
+
+					// keep the unread part of a record, and read behind it
+					std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+					_end -= _begin;
+					_begin = 0;
+					if (bytes > _buffer.size()) {
+						_buffer.resize(bytes);
+					}
+					while (_end < bytes && _file) {
+						_file.read(_buffer.data() + _end, static_cast<std::streamsize>(_buffer.size() - _end));
+						_end += static_cast<std::size_t>(_file.gcount());
+					}
+					return _end >= bytes;
+				}
+
+				std::ifstream _file;
+				std::string _path;
+				std::vector<char> _buffer;
+				std::size_t _begin = 0;
+				std::size_t _end = 0;
+			};
+
+
+			// Merges the (non empty) runs [first, last) into output.  Equal addresses are taken from the earlier run first.
+			void merge(const std::vector<std::string> & runs, std::size_t first, std::size_t last, std::size_t bufferSize, RecordWriter & output) {
+				std::vector<std::unique_ptr<RunReader>> readers;
+				std::vector<Address> heads(last - first);
+				for (std::size_t run = first; run < last; ++run) {
+					readers.push_back(std::make_unique<RunReader>(runs[run], bufferSize));
+					readers.back()->next(heads[run - first]);
+				}
+
+				auto less = [&heads](std::size_t lhs, std::size_t rhs) { return heads[lhs] < heads[rhs]; };
+				Utilities::LoserTree<decltype(less)> tree(heads.size(), less);
+				while (!tree.empty()) {
+					const std::size_t winner = tree.winner();
+					output.put(heads[winner]);
+					tree.replay(!readers[winner]->next(heads[winner]));
+				}
+			}
+		}
+
+		/**********************
+		* Statistics
+		**********************/
+		double Statistics::seconds() const noexcept {
+			return runSeconds + mergeSeconds;
+		}
+
+		double Statistics::throughput() const noexcept {
+			return seconds() > 0 ? static_cast<double>(inputBytes) / seconds() : 0;
+		}
+
+
+		/**********************
+		* Sorting
+		**********************/
+		Statistics sortFile(const std::string & input, const std::string & output, const Options & options) {
+			Statistics statistics;
+			RunFiles runFiles(options.tempDirectory, output);
+			std::vector<std::string> runs;
+			const std::size_t writeBuffer = bufferSize(options.memoryBudget, 7);   // an eighth of the budget
+
+			// run formation:  sort what fits in the budget, write it out, repeat
+			Clock::time_point start = Clock::now();
+			{
+				std::vector<Address> records;
+				std::size_t held = 0;
+				auto spill = [&]() {
+					Collation::sort(records);
+					runs.push_back(runFiles.create());
+					RecordWriter run(runs.back(), writeBuffer, true);
+					for (const auto & address : records) {
+						run.put(address);
+					}
+					statistics.runBytes += run.finish();
+					records.clear();
+					held = 0;
+				};
+
+				const Utilities::MappedFile file(input);
+				statistics.inputBytes = file.size();
+				Utilities::Records::forEachRecord(file.contents(), [&](Utilities::StringView record, const Utilities::Records::Fields & fields) {
+					records.emplace_back();
+					if (!fromRecord(fields, records.back())) {
+						records.pop_back();
+						return;
+					}
+					++statistics.records;
+
+					held += RECORD_OVERHEAD + record.size();
+					if (held >= options.memoryBudget) {
+						spill();
+					}
+				});
+
+				// everything fit, there is nothing to merge
+				if (runs.empty()) {
+					Collation::sort(records);
+					RecordWriter sorted(output, writeBuffer, false);
+					for (const auto & address : records) {
+						sorted.put(address);
+					}
+					statistics.outputBytes = sorted.finish();
+					statistics.runSeconds = since(start);
+					return statistics;
+				}
+				if (!records.empty()) {
+					spill();
+				}
+			}
+			statistics.runs = runs.size();
+			statistics.runSeconds = since(start);
+
+			// merge passes, until the runs left can all be merged into the output at once
+			start = Clock::now();
+			const std::size_t fanIn = options.maxFanIn >= 2 ? options.maxFanIn
+			                                                : std::min(std::max<std::size_t>(2, options.memoryBudget / MIN_BUFFER - 1), MAX_FAN_IN);
+			while (runs.size() > fanIn) {
+				std::vector<std::string> merged;
+				for (std::size_t first = 0; first < runs.size(); first += fanIn) {
+					const std::size_t last = std::min(first + fanIn, runs.size());
+					if (last - first == 1) {
+						merged.push_back(runs[first]);
+						continue;
+					}
+
+					merged.push_back(runFiles.create());
+					RecordWriter run(merged.back(), bufferSize(options.memoryBudget, last - first), true);
+					merge(runs, first, last, bufferSize(options.memoryBudget, last - first), run);
+					statistics.runBytes += run.finish();
+					for (std::size_t i = first; i < last; ++i) {
+						std::remove(runs[i].c_str());
+					}
+				}
+				runs.swap(merged);
+				++statistics.mergePasses;
+			}
+
+			RecordWriter sorted(output, bufferSize(options.memoryBudget, runs.size()), false);
+			merge(runs, 0, runs.size(), bufferSize(options.memoryBudget, runs.size()), sorted);
+			statistics.outputBytes = sorted.finish();
+			++statistics.mergePasses;
+			statistics.mergeSeconds = since(start);
+
+			return statistics;
+		}
+	}
+}
@@ -0,0 +1,75 @@
+/**
+ * File: ExternalSort.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the external (out of core) address sort,
+ *				for files of records (as written by operator<<) too large to sort in memory.
+ *				The input is read in pieces that fit the memory budget; each piece is
+ *				sorted and written to a temporary run file in the binary record format.
+ *				The runs are then merged with a loser tree into the output, in passes of at
+ *				most fanIn runs if there are more runs than fit the budget at once.
+ *
+ *				The output is in Addresses::operator< order (state, city, zip code, street).
+ *				The sort is stable:  equal addresses keep their input order.  Temporary
+ *				files are removed when the sort finishes or throws.
+ *
+ *				Usage:
+ *				        Addresses::ExternalSort::Options options;
+ *				        options.memoryBudget = 512 * 1024 * 1024;
+ *				        auto statistics = Addresses::ExternalSort::sortFile("mailing.dat", "sorted.dat", options);
+ **/
+
+#ifndef ADDRESSES_ExternalSort_hpp
+#define ADDRESSES_ExternalSort_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Utilities/Exceptions.hpp"
+
+
+
+
+namespace Addresses
+{
+  namespace ExternalSort
+  {
+    // Inner Exception Type Hierarchy Definition
+    struct ExternalSortExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // External sort exception base class
+    struct   FileException        : ExternalSortExceptions         { using ExternalSortExceptions::ExternalSortExceptions; };  // a run or output file can't be written or read
+
+
+    struct Options
+    {
+      std::size_t   memoryBudget  = 256 * 1024 * 1024;   // approximate bytes of records held in memory at once
+      std::string   tempDirectory = ".";                 // where run files are written, on a local filesystem
+      std::size_t   maxFanIn      = 0;                   // runs merged at once, 0 for as many as the budget buffers (at most 256)
+    };
+
+
+    struct Statistics
+    {
+      std::size_t     records      = 0;
+      std::size_t     runs         = 0;     // sorted runs written, 0 if the input fit in memory
+      std::size_t     mergePasses  = 0;     // passes over the data after run formation
+      std::uint64_t   inputBytes   = 0;
+      std::uint64_t   outputBytes  = 0;
+      std::uint64_t   runBytes     = 0;     // bytes written to run files, over all passes
+      double          runSeconds   = 0;     // reading, sorting and writing runs
+      double          mergeSeconds = 0;
+
+      double  seconds    () const noexcept;
+      double  throughput () const noexcept;   // input bytes per second, over the whole sort
+    };
+
+
+
+
+    // Sorts the address records of input into output.  Throws the Address exceptions for a record that isn't valid,
+    // Utilities::MappedFile::MappedFileExceptions if input can't be read, and FileException for output or run file errors.
+    Statistics sortFile( const std::string & input, const std::string & output, const Options & options = Options() );
+  } // namespace ExternalSort
+} // namespace Addresses
+#endif
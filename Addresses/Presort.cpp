@@ -0,0 +1,201 @@
+/**
+ * File: Presort.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the bulk mail presort.  Each record's
+ *				key is its packed zip code (zip5 and +4, 31 bits) above its state ordinal
+ *				(8 bits).  Keys are sorted a byte at a time, lowest byte first, with one
+ *				counting pass per byte; a byte that is the same in every key of a range is
+ *				skipped.  Records with equal keys are then put in street order.
+ **/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Addresses/Presort.hpp"
+
+namespace Addresses {
+	namespace Presort {
+		namespace {
+			constexpr unsigned    KEY_BYTES = 5;       // 31 bit zip code above an 8 bit state ordinal
+			constexpr std::size_t ZIP3_COUNT = 1000;
+
+			struct Item {
+				std::uint64_t key;
+				std::uint32_t index;
+			};
+
+			inline std::uint64_t makeKey(ZipCode::Packed zip, States::Ordinal state) noexcept {
+				return (static_cast<std::uint64_t>(zip) << 8) | state;
+			}
+
+			inline std::size_t zip3(std::uint64_t key) noexcept {
+				return ZipCode::zip5(static_cast<ZipCode::Packed>(key >> 8)) / 100;
+			}
+
+			// LSD radix sort of items[begin, end) by key, using scratch[begin, end).  Stable.
+			void radixSort(std::vector<Item> & items, std::vector<Item> & scratch, std::size_t begin, std::size_t end) {
+				Item * from = items.data() + begin;
+				Item * to   = scratch.data() + begin;
+				const std::size_t count = end - begin;
+
+				for (unsigned byte = 0; byte < KEY_BYTES; ++byte) {
+					const unsigned shift = byte * 8;
+
+					std::array<std::size_t, 256> offsets{};
+					for (std::size_t i = 0; i < count; ++i) {
+						++offsets[(from[i].key >> shift) & 0xFF];
+					}
+					// every key has the same byte, nothing to move
+					if (offsets[(from[0].key >> shift) & 0xFF] == count) {
+						continue;
+					}
+
+					std::size_t total = 0;
+					for (auto & offset : offsets) {
+						const std::size_t bucket = offset;
+						offset = total;
+						total += bucket;
+					}
+					for (std::size_t i = 0; i < count; ++i) {
+						to[offsets[(from[i].key >> shift) & 0xFF]++] = from[i];
+					}
+					std::swap(from, to);
+				}
+
+				if (from != items.data() + begin) {
+					std::copy(from, from + count, items.data() + begin);
+				}
+			}
+
+			// orders each run of equal keys in items[begin, end) by street.  Runs are in index order already, so a stable sort keeps it.
+			template <typename StreetOf>
+			void orderStreets(std::vector<Item> & items, std::size_t begin, std::size_t end, const StreetOf & streetOf) {
+				for (std::size_t run = begin; run < end; ) {
+					std::size_t runEnd = run + 1;
+					while (runEnd < end && items[runEnd].key == items[run].key) {
+						++runEnd;
+					}
+					if (runEnd - run > 1) {
+						std::stable_sort(items.begin() + static_cast<std::ptrdiff_t>(run), items.begin() + static_cast<std::ptrdiff_t>(runEnd),
+							[&streetOf](const Item & lhs, const Item & rhs) { return streetOf(lhs.index) < streetOf(rhs.index); });
+					}
+					run = runEnd;
+				}
+			}
+
+			template <typename StreetOf>
+			std::vector<std::uint32_t> sortItems(std::vector<Item> & items, std::size_t threadCount, const StreetOf & streetOf) {
+				std::vector<Item> scratch(items.size());
+
+				if (threadCount <= 1 || items.size() < ZIP3_COUNT) {
+					if (!items.empty()) {
+						radixSort(items, scratch, 0, items.size());
+					}
+					orderStreets(items, 0, items.size(), streetOf);
+				}
+				else {
+					// partition by ZIP3 into scratch (a stable counting pass), then sort the partitions in parallel
+					std::vector<std::size_t> bounds(ZIP3_COUNT + 1, 0);
+					for (const auto & item : items) {
+						++bounds[zip3(item.key) + 1];
+					}
+					for (std::size_t partition = 1; partition <= ZIP3_COUNT; ++partition) {
+						bounds[partition] += bounds[partition - 1];
+					}
+					std::vector<std::size_t> next(bounds.begin(), bounds.end() - 1);
+					for (const auto & item : items) {
+						scratch[next[zip3(item.key)]++] = item;
+					}
+					items.swap(scratch);
+
+					std::atomic<std::size_t> nextPartition{ 0 };
+					auto worker = [&]() {
+						for (std::size_t partition = nextPartition++; partition < ZIP3_COUNT; partition = nextPartition++) {
+							const std::size_t begin = bounds[partition];
+							const std::size_t end   = bounds[partition + 1];
+							if (end - begin > 1) {
+								radixSort(items, scratch, begin, end);
+								orderStreets(items, begin, end, streetOf);
+							}
+						}
+					};
+
+					// if a thread can't be started, the ones that were (and this one) take every partition; none may be left unjoined
+					std::vector<std::thread> pool;
+					try {
+						pool.reserve(threadCount - 1);
+						for (std::size_t i = 1; i < threadCount; ++i) {
+							pool.emplace_back(worker);
+						}
+					}
+					catch (...) {}
+					worker();  // the calling thread works too
+					for (auto & thread : pool) {
+						thread.join();
+					}
+				}
+
+				std::vector<std::uint32_t> indexes;
+				indexes.reserve(items.size());
+				for (const auto & item : items) {
+					indexes.push_back(item.index);
+				}
+				return indexes;
+			}
+		}
+
+		/**********************
+		* Presort
+		**********************/
+		std::vector<std::uint32_t> order(const std::vector<Address> & addresses, std::size_t threadCount) {
+			std::vector<Item> items;
+			items.reserve(addresses.size());
+			for (std::size_t i = 0; i < addresses.size(); ++i) {
+				items.push_back({ makeKey(addresses[i].packedZipCode(), addresses[i].stateOrdinal()), static_cast<std::uint32_t>(i) });
+			}
+
+			return sortItems(items, threadCount, [&addresses](std::uint32_t index) { return addresses[index].streetView(); });
+		}
+
+		std::vector<std::uint32_t> order(const AddressTable & table, std::size_t threadCount) {
+			// only the zip code and state columns are read to build the keys
+			const std::vector<ZipCode::Packed> & zips   = table.zipCodes();
+			const std::vector<States::Ordinal> & states = table.states();
+
+			std::vector<Item> items;
+			items.reserve(table.size());
+			for (std::size_t row = 0; row < table.size(); ++row) {
+				items.push_back({ makeKey(zips[row], states[row]), static_cast<std::uint32_t>(row) });
+			}
+
+			const Utilities::StringPool & strings = table.strings();
+			const std::vector<Utilities::StringPool::Id> & streets = table.streetIds();
+			return sortItems(items, threadCount, [&strings, &streets](std::uint32_t row) { return strings[streets[row]]; });
+		}
+
+		void sort(std::vector<Address> & addresses, std::size_t threadCount) {
+			const std::vector<std::uint32_t> indexes = order(addresses, threadCount);
+
+			std::vector<Address> sorted;
+			sorted.reserve(addresses.size());
+			for (const std::uint32_t index : indexes) {
+				sorted.push_back(std::move(addresses[index]));
+			}
+			addresses = std::move(sorted);
+		}
+
+		bool before(const Address & lhs, const Address & rhs) noexcept {
+			const std::uint64_t lhsKey = makeKey(lhs.packedZipCode(), lhs.stateOrdinal());
+			const std::uint64_t rhsKey = makeKey(rhs.packedZipCode(), rhs.stateOrdinal());
+			return lhsKey < rhsKey || (lhsKey == rhsKey && lhs.streetView() < rhs.streetView());
+		}
+	}
+}
@@ -0,0 +1,49 @@
+/**
+ * File: Presort.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the bulk mail presort:  addresses ordered
+ *				by 5 digit zip code, then +4, then state, then street.  The zip code and
+ *				state are packed into one integer key per record and sorted with a least
+ *				significant digit radix sort; strings are only compared to order records
+ *				whose keys are equal.
+ *
+ *				With more than one thread the records are first partitioned by ZIP3 (the
+ *				first three digits of the zip code, i.e. the sectional center facility),
+ *				and the partitions are sorted in parallel.
+ *
+ *				Usage:
+ *				        std::vector<std::uint32_t> mailing = Addresses::Presort::order(table, Utilities::defaultThreadCount());
+ *				        for (auto row : mailing)  print(table[row]);
+ **/
+
+#ifndef ADDRESSES_Presort_hpp
+#define ADDRESSES_Presort_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressTable.hpp"
+
+
+
+
+namespace Addresses
+{
+  namespace Presort
+  {
+    // The record indexes in presort order.  Records that are equal in every presort field keep their relative order.
+    // Collections must have fewer than 2^32 records.
+    std::vector<std::uint32_t>  order ( const std::vector<Address> & addresses, std::size_t threadCount = 1 );
+    std::vector<std::uint32_t>  order ( const AddressTable &         table,     std::size_t threadCount = 1 );
+
+    void                        sort  ( std::vector<Address> & addresses, std::size_t threadCount = 1 );
+
+    // True if lhs comes before rhs in presort order (the comparison the radix sort is equivalent to)
+    bool                        before( const Address & lhs, const Address & rhs ) noexcept;
+  } // namespace Presort
+} // namespace Addresses
+#endif
@@ -0,0 +1,249 @@
+/**
+ * File: States.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the shared state table.
+ *				Codes and names are each found through a perfect hash that is
+ *				searched for at compile time, so a lookup is one hash, one table
+ *				probe and one comparison.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Addresses/States.hpp"
+
+namespace Addresses {
+	namespace States {
+		namespace {
+			struct Entry {
+				const char * code;
+				const char * name;
+			};
+
+			// state codes and names, sorted by name (see Ordinal).  Index 0 is Ordinal NONE.
+			constexpr Entry STATES[COUNT + 1] =
+			{
+				{ "", "" },
+				{ "AL","Alabama" },
+				{ "AK","Alaska" },
+				{ "AZ","Arizona" },
+				{ "AR","Arkansas" },
+				{ "CA","California" },
+				{ "CO","Colorado" },
+				{ "CT","Connecticut" },
+				{ "DE","Delaware" },
+				{ "DC","District of Columbia" },
+				{ "FL","Florida" },
+				{ "GA","Georgia" },
+				{ "HI","Hawaii" },
+				{ "ID","Idaho" },
+				{ "IL","Illinois" },
+				{ "IN","Indiana" },
+				{ "IA","Iowa" },
+				{ "KS","Kansas" },
+				{ "KY","Kentucky" },
+				{ "LA","Louisiana" },
+				{ "ME","Maine" },
+				{ "MD","Maryland" },
+				{ "MA","Massachusetts" },
+				{ "MI","Michigan" },
+				{ "MN","Minnesota" },
+				{ "MS","Mississippi" },
+				{ "MO","Missouri" },
+				{ "MT","Montana" },
+				{ "NE","Nebraska" },
+				{ "NV","Nevada" },
+				{ "NH","New Hampshire" },
+				{ "NJ","New Jersey" },
+				{ "NM","New Mexico" },
+				{ "NY","New York" },
+				{ "NC","North Carolina" },
+				{ "ND","North Dakota" },
+				{ "OH","Ohio" },
+				{ "OK","Oklahoma" },
+				{ "OR","Oregon" },
+				{ "PA","Pennsylvania" },
+				{ "RI","Rhode Island" },
+				{ "SC","South Carolina" },
+				{ "SD","South Dakota" },
+				{ "TN","Tennessee" },
+				{ "TX","Texas" },
+				{ "UT","Utah" },
+				{ "VT","Vermont" },
+				{ "VA","Virginia" },
+				{ "WA","Washington" },
+				{ "WV","West Virginia" },
+				{ "WI","Wisconsin" },
+				{ "WY","Wyoming" },
+			};
+
+			/***********************
+			* compile time helpers
+			**********************/
+			constexpr std::size_t length(const char * text) {
+				std::size_t n = 0;
+				while (text[n] != '\0') {
+					++n;
+				}
+				return n;
+			}
+
+			// ASCII only, matches the std::toupper/std::tolower behavior of the classic locale
+			constexpr char toUpper(char c) {
+				return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+			}
+			constexpr char toLower(char c) {
+				return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+			}
+
+			constexpr bool isSortedByName() {
+				for (std::size_t i = 2; i <= COUNT; ++i) {
+					const char * lhs = STATES[i - 1].name;
+					const char * rhs = STATES[i].name;
+					while (*lhs != '\0' && *lhs == *rhs) {
+						++lhs;
+						++rhs;
+					}
+					if (static_cast<unsigned char>(*lhs) >= static_cast<unsigned char>(*rhs)) {
+						return false;
+					}
+				}
+				return true;
+			}
+			static_assert(isSortedByName(), "State table must be sorted by name, ordinals are compared as names");
+
+			/***********************
+			* perfect hashes
+			**********************/
+			constexpr std::size_t SLOTS = 256;  // must be a power of two, at least 5x COUNT keeps the seed search short
+
+			constexpr std::size_t slotOf(std::uint32_t hash) {
+				// Fibonacci hashing, the top bits of the product are the best mixed
+				return static_cast<std::uint32_t>(hash * 2654435761u) >> 24;
+			}
+
+			// codes are hashed after being converted to uppercase
+			constexpr std::uint32_t hashCode(const char * code, std::uint32_t seed) {
+				return static_cast<std::uint32_t>(toUpper(code[0]) - 'A') * seed + static_cast<std::uint32_t>(toUpper(code[1]) - 'A');
+			}
+
+			// names are hashed after being converted to lowercase
+			constexpr std::uint32_t hashName(const char * name, std::size_t n, std::uint32_t seed) {
+				std::uint32_t hash = static_cast<std::uint32_t>(n);
+				for (std::size_t i = 0; i < n; ++i) {
+					hash = hash * seed + static_cast<unsigned char>(toLower(name[i]));
+				}
+				return hash;
+			}
+
+			struct SlotTable {
+				std::uint32_t seed;
+				Ordinal       slot[SLOTS];
+			};
+
+			// Search for the first seed that sends every key to a distinct slot.  Empty slots hold NONE.
+			template <bool CODES>
+			constexpr SlotTable buildSlotTable() {
+				SlotTable table{};
+				for (std::uint32_t seed = 1; seed < 100000; ++seed) {
+					for (std::size_t i = 0; i < SLOTS; ++i) {
+						table.slot[i] = NONE;
+					}
+
+					bool collision = false;
+					for (std::size_t state = 1; state <= COUNT && !collision; ++state) {
+						const std::uint32_t hash = CODES ? hashCode(STATES[state].code, seed)
+						                                 : hashName(STATES[state].name, length(STATES[state].name), seed);
+						Ordinal & slot = table.slot[slotOf(hash)];
+						if (slot != NONE) {
+							collision = true;
+						}
+						slot = static_cast<Ordinal>(state);
+					}
+
+					if (!collision) {
+						table.seed = seed;
+						return table;
+					}
+				}
+				table.seed = 0;
+				return table;
+			}
+
+			constexpr SlotTable CODE_SLOTS = buildSlotTable<true>();
+			constexpr SlotTable NAME_SLOTS = buildSlotTable<false>();
+			static_assert(CODE_SLOTS.seed != 0, "No perfect hash seed found for state codes");
+			static_assert(NAME_SLOTS.seed != 0, "No perfect hash seed found for state names");
+
+			struct LengthTable {
+				std::size_t length[COUNT + 1];
+			};
+			constexpr LengthTable buildLengthTable() {
+				LengthTable table{};
+				for (std::size_t state = 0; state <= COUNT; ++state) {
+					table.length[state] = length(STATES[state].name);
+				}
+				return table;
+			}
+
+			constexpr LengthTable NAME_LENGTHS = buildLengthTable();
+		}
+
+		/***********************
+		* lookups
+		**********************/
+		Ordinal fromCode(const char * code, std::size_t length) noexcept {
+			if (length != 2) {
+				return NONE;
+			}
+
+			const char first  = toUpper(code[0]);
+			const char second = toUpper(code[1]);
+			if (first < 'A' || first > 'Z' || second < 'A' || second > 'Z') {
+				return NONE;
+			}
+
+			// the hash is perfect, so the slot holds the only state this could be.  Make sure it is that one.
+			const Ordinal state = CODE_SLOTS.slot[slotOf(hashCode(code, CODE_SLOTS.seed))];
+			if (state != NONE && STATES[state].code[0] == first && STATES[state].code[1] == second) {
+				return state;
+			}
+			return NONE;
+		}
+
+		Ordinal fromName(const char * name, std::size_t length) noexcept {
+			if (length == 0) {
+				return NONE;
+			}
+
+			const Ordinal state = NAME_SLOTS.slot[slotOf(hashName(name, length, NAME_SLOTS.seed))];
+			if (state == NONE || NAME_LENGTHS.length[state] != length) {
+				return NONE;
+			}
+
+			// case insensitive comparison against the only candidate
+			const char * candidate = STATES[state].name;
+			for (std::size_t i = 0; i < length; ++i) {
+				if (toLower(name[i]) != toLower(candidate[i])) {
+					return NONE;
+				}
+			}
+			return state;
+		}
+
+		/***********************
+		* queries
+		**********************/
+		const char * name(Ordinal state) noexcept {
+			return state <= COUNT ? STATES[state].name : STATES[NONE].name;
+		}
+		std::size_t nameLength(Ordinal state) noexcept {
+			return state <= COUNT ? NAME_LENGTHS.length[state] : 0;
+		}
+		const char * code(Ordinal state) noexcept {
+			return state <= COUNT ? STATES[state].code : STATES[NONE].code;
+		}
+	}
+}
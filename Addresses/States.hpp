@@ -0,0 +1,44 @@
+/**
+ * File: States.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the shared state table used to validate and
+ *				normalize the state portion of an Address.  The table is built at compile time
+ *				and lookups never allocate.
+ **/
+
+#ifndef ADDRESSES_States_hpp
+#define ADDRESSES_States_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+
+
+
+namespace Addresses
+{
+  namespace States
+  {
+    // Each state (plus the District of Columbia) is identified by a small ordinal.  Ordinals are assigned in alphabetical order
+    // of the full state name so comparing two ordinals gives the same answer as comparing the two names.  Ordinal NONE is
+    // reserved for "no state" (e.g. a default constructed Address) and orders before every real state.
+    using Ordinal = std::uint8_t;
+
+    constexpr Ordinal NONE  = 0;
+    constexpr Ordinal COUNT = 51;   // valid ordinals are 1 through COUNT, inclusive
+
+
+    // Lookups - return NONE if the text does not identify a state
+    Ordinal       fromCode   ( const char * code, std::size_t length ) noexcept;  // two letter postal code, any case ("CA", "ca")
+    Ordinal       fromName   ( const char * name, std::size_t length ) noexcept;  // full name, any case ("California", "caLIFornia")
+
+
+    // Queries - the ordinal must be NONE or a valid ordinal
+    const char *  name       ( Ordinal state ) noexcept;                          // "California", or "" for NONE
+    std::size_t   nameLength ( Ordinal state ) noexcept;
+    const char *  code       ( Ordinal state ) noexcept;                          // "CA", or "" for NONE
+  } // namespace States
+} // namespace Addresses
+#endif
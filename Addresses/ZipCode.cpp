@@ -0,0 +1,138 @@
+/**
+ * File: ZipCode.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the zip code validator.
+ *				Every character is looked at exactly once and the digit checks are
+ *				accumulated without branching, so validation costs about as much as
+ *				converting the digits to a number.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Addresses/ZipCode.hpp"
+
+namespace Addresses {
+	namespace ZipCode {
+		namespace {
+			constexpr std::uint32_t ALL_NINES_ZIP5  = 99999;
+			constexpr std::uint32_t ALL_NINES_PLUS4 = 9999;
+
+			// converts count digits to a number.  Any non-digit sets the returned flag.
+			inline std::uint32_t toNumber(const char * text, std::size_t count, bool & bad) noexcept {
+				std::uint32_t value = 0;
+				unsigned      notDigit = 0;
+				for (std::size_t i = 0; i < count; ++i) {
+					// characters below '0' wrap around to large values, so one compare finds every non-digit
+					const std::uint32_t digit = static_cast<std::uint32_t>(static_cast<unsigned char>(text[i])) - '0';
+					notDigit |= digit > 9;
+					value = value * 10 + digit;
+				}
+				bad = notDigit != 0;
+				return value;
+			}
+		}
+
+		/***********************
+		* validation and parsing
+		**********************/
+		Packed parse(const char * text, std::size_t length) noexcept {
+			if (length != 5 && length != MAX_LENGTH) {
+				return NONE;
+			}
+
+			bool bad = false;
+			const std::uint32_t zip = toNumber(text, 5, bad);
+			if (bad || zip == 0 || zip == ALL_NINES_ZIP5) {
+				return NONE;
+			}
+			if (length == 5) {
+				return zip << PLUS4_BITS;
+			}
+
+			// optional +4
+			if (text[5] != '-') {
+				return NONE;
+			}
+			const std::uint32_t extension = toNumber(text + 6, 4, bad);
+			if (bad || extension == 0 || extension == ALL_NINES_PLUS4) {
+				return NONE;
+			}
+			return (zip << PLUS4_BITS) | extension;
+		}
+
+		Packed parse(unsigned long zip5) noexcept {
+			return parse(zip5, 0);
+		}
+
+		Packed parse(unsigned long zip5, unsigned long plus4) noexcept {
+			if (zip5 == 0 || zip5 >= ALL_NINES_ZIP5 || plus4 >= ALL_NINES_PLUS4) {
+				return NONE;
+			}
+			return (static_cast<Packed>(zip5) << PLUS4_BITS) | static_cast<Packed>(plus4);
+		}
+
+		bool isValid(const char * text, std::size_t length) noexcept {
+			return parse(text, length) != NONE;
+		}
+
+		bool isValid(unsigned long zip5) noexcept {
+			return parse(zip5) != NONE;
+		}
+
+		/***********************
+		* formatting
+		**********************/
+		std::size_t format(Packed zip, char * buffer) noexcept {
+			if (zip == NONE) {
+				return 0;
+			}
+
+			// digits are written right to left, zero padded
+			std::uint32_t value = zip5(zip);
+			for (std::size_t i = 5; i-- > 0; value /= 10) {
+				buffer[i] = static_cast<char>('0' + value % 10);
+			}
+
+			value = plus4(zip);
+			if (value == 0) {
+				return 5;
+			}
+
+			buffer[5] = '-';
+			for (std::size_t i = MAX_LENGTH; i-- > 6; value /= 10) {
+				buffer[i] = static_cast<char>('0' + value % 10);
+			}
+			return MAX_LENGTH;
+		}
+
+		/***********************
+		* prefix queries
+		**********************/
+		bool prefixRange(const char * prefix, std::size_t length, Packed & first, Packed & last) noexcept {
+			if (length > 5) {
+				return false;
+			}
+
+			bool bad = false;
+			std::uint32_t low = toNumber(prefix, length, bad);
+			if (bad) {
+				return false;
+			}
+
+			// "926" is 92600 through 92699
+			std::uint32_t scale = 1;
+			for (std::size_t i = length; i < 5; ++i) {
+				scale *= 10;
+			}
+			low *= scale;
+
+			// 00000 is not a valid zip code, starting past it keeps NONE out of every range
+			first = (low == 0 ? 1 : low) << PLUS4_BITS;
+			last  = ((low + scale - 1) << PLUS4_BITS) | ((Packed{1} << PLUS4_BITS) - 1);
+			return true;
+		}
+	}
+}
@@ -0,0 +1,79 @@
+/**
+ * File: ZipCode.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the zip code validator used by Address.
+ *				Zip codes are validated in a single pass over raw characters or numbers,
+ *				without regular expressions or memory allocation.
+ *
+ *				Zip code rules:  5 digits, not all are zero and not all are nine, optionally followed
+ *				                 by a hyphen and 4 digits, not all are zero and not all are nine.
+ **/
+
+#ifndef ADDRESSES_ZipCode_hpp
+#define ADDRESSES_ZipCode_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Utilities/Simd.hpp"
+
+
+
+
+namespace Addresses
+{
+  namespace ZipCode
+  {
+    // A valid zip code packed into an integer:  the 5 digit zip in the high bits and the +4 in the low 14 bits.  Since neither
+    // part may be zero, a +4 of zero means "no +4" and a packed value of zero (NONE) means "no zip code".  Packed values order
+    // the same as their zip codes do:  by zip, then by +4, with the 5 digit form before any of its +4 forms.
+    using Packed = std::uint32_t;
+
+    constexpr Packed        NONE         = 0;
+    constexpr unsigned      PLUS4_BITS   = 14;
+    constexpr std::size_t   MAX_LENGTH   = 10;  // "12345-6789"
+
+    constexpr std::uint32_t zip5  ( Packed zip ) noexcept  { return zip >> PLUS4_BITS; }
+    constexpr std::uint32_t plus4 ( Packed zip ) noexcept  { return zip & ((Packed{1} << PLUS4_BITS) - 1); }
+
+
+    // Validation and parsing - parse() returns NONE if the zip code is not valid
+    Packed        parse    ( const char * text, std::size_t length ) noexcept;  // "12345" or "12345-6789"
+    Packed        parse    ( unsigned long zip5                    ) noexcept;  // 12345, zero padded to 5 digits (12 is "00012")
+    Packed        parse    ( unsigned long zip5, unsigned long plus4 ) noexcept;  // 12345, 6789 - a plus4 of 0 means none
+    bool          isValid  ( const char * text, std::size_t length ) noexcept;
+    bool          isValid  ( unsigned long zip5                    ) noexcept;
+
+
+    // Formatting - writes the 5 or 10 character form of a packed zip code (no null terminator) to buffer, which must hold at
+    // least MAX_LENGTH characters.  Returns the number of characters written, which is 0 for NONE.
+    std::size_t   format   ( Packed zip, char * buffer ) noexcept;
+
+
+    // Prefix queries - every valid packed zip code whose 5 digit zip starts with prefix falls in [first, last], and NONE never does.
+    // For example "926" covers 92600 through 92699 and all of their +4 forms, and "" covers every zip code.  Returns false if
+    // prefix is not 0 to 5 digits.
+    bool          prefixRange ( const char * prefix, std::size_t length, Packed & first, Packed & last ) noexcept;
+
+
+
+
+    // Batch validation of many zip codes stored in a packed buffer of fixed size slots.  Each slot is SLOT_SIZE characters and holds
+    // either a "12345-6789" zip code or a "12345" zip code followed by 5 '\0' characters; anything else is not valid.  A slot is
+    // valid exactly when the per-zip-code isValid() would accept the same text.
+    //
+    //   slots   count * SLOT_SIZE characters
+    //   valid   bitmap of (count + 7) / 8 bytes, bit (i % 8) of byte (i / 8) is set when slot i is valid
+    //   zips    count packed values, NONE for slots that are not valid (optional, may be nullptr)
+    //
+    // Returns the number of valid slots.  Uses the widest instruction set the processor supports unless told otherwise, the
+    // results are the same for all of them.
+    constexpr std::size_t SLOT_SIZE = MAX_LENGTH;
+
+    std::size_t   validate ( const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips ) noexcept;
+    std::size_t   validate ( const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips, Utilities::Simd::Isa isa ) noexcept;
+  } // namespace ZipCode
+} // namespace Addresses
+#endif
@@ -0,0 +1,215 @@
+/**
+ * File: ZipCodeBatch.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of batch zip code validation.
+ *				Six 10 character slots (60 bytes) are compared against '0'..'9', '-',
+ *				'0', '9' and '\0' at once with SSE2 or AVX2, and each comparison is
+ *				reduced to a 64 bit mask with one bit per character.  The zip code rules
+ *				are then checked with a handful of mask operations per slot.  Slots that
+ *				don't fill a whole block are checked one at a time.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Addresses/ZipCode.hpp"
+#include "Utilities/Simd.hpp"
+
+#ifdef UTILITIES_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+namespace Addresses {
+	namespace ZipCode {
+		namespace {
+			constexpr std::size_t BLOCK_SLOTS = 6;   // slots per block, 60 of the 64 characters compared
+			constexpr std::size_t BLOCK_BYTES = 64;  // characters read per block
+
+			// bits of a slot's 10 bit masks
+			constexpr std::uint32_t ZIP5_DIGITS  = 0x01F;
+			constexpr std::uint32_t HYPHEN       = 0x020;
+			constexpr std::uint32_t PLUS4_DIGITS = 0x3C0;
+			constexpr std::uint32_t PADDING      = 0x3E0;
+			constexpr std::uint32_t SLOT_BITS    = 0x3FF;
+
+			// one bit per character of a block
+			struct Masks {
+				std::uint64_t digits;
+				std::uint64_t zeros;
+				std::uint64_t nines;
+				std::uint64_t nuls;
+				std::uint64_t hyphens;
+			};
+
+			// the zip code rules applied to one slot's bits of the masks
+			inline bool isValidSlot(const Masks & masks, unsigned shift) noexcept {
+				const std::uint32_t digits  = static_cast<std::uint32_t>(masks.digits  >> shift) & SLOT_BITS;
+				const std::uint32_t zeros   = static_cast<std::uint32_t>(masks.zeros   >> shift) & SLOT_BITS;
+				const std::uint32_t nines   = static_cast<std::uint32_t>(masks.nines   >> shift) & SLOT_BITS;
+				const std::uint32_t nuls    = static_cast<std::uint32_t>(masks.nuls    >> shift) & SLOT_BITS;
+				const std::uint32_t hyphens = static_cast<std::uint32_t>(masks.hyphens >> shift) & SLOT_BITS;
+
+				const bool zip5  = (digits & ZIP5_DIGITS) == ZIP5_DIGITS
+				                && (zeros  & ZIP5_DIGITS) != ZIP5_DIGITS
+				                && (nines  & ZIP5_DIGITS) != ZIP5_DIGITS;
+				const bool plus4 = (hyphens & HYPHEN) != 0
+				                && (digits & PLUS4_DIGITS) == PLUS4_DIGITS
+				                && (zeros  & PLUS4_DIGITS) != PLUS4_DIGITS
+				                && (nines  & PLUS4_DIGITS) != PLUS4_DIGITS;
+				const bool pad   = (nuls & PADDING) == PADDING;
+
+				return zip5 && (plus4 || pad);
+			}
+
+			// converts a slot already known to be valid
+			inline Packed toPacked(const char * slot) noexcept {
+				std::uint32_t zip = 0;
+				for (std::size_t i = 0; i < 5; ++i) {
+					zip = zip * 10 + static_cast<std::uint32_t>(slot[i] - '0');
+				}
+				std::uint32_t extension = 0;
+				if (slot[5] == '-') {
+					for (std::size_t i = 6; i < SLOT_SIZE; ++i) {
+						extension = extension * 10 + static_cast<std::uint32_t>(slot[i] - '0');
+					}
+				}
+				return (zip << PLUS4_BITS) | extension;
+			}
+
+			inline void record(std::size_t index, bool isValid, const char * slot, std::uint8_t * valid, Packed * zips) noexcept {
+				if (isValid) {
+					valid[index / 8] = static_cast<std::uint8_t>(valid[index / 8] | (1u << (index % 8)));
+				}
+				if (zips != nullptr) {
+					zips[index] = isValid ? toPacked(slot) : NONE;
+				}
+			}
+
+			// one slot at a time, using the same rules as ZipCode::isValid()
+			std::size_t validateScalar(const char * slots, std::size_t first, std::size_t count, std::uint8_t * valid, Packed * zips) noexcept {
+				std::size_t validCount = 0;
+				for (std::size_t i = first; i < count; ++i) {
+					const char * slot = slots + i * SLOT_SIZE;
+
+					bool isValid;
+					if (slot[5] == '\0') {
+						isValid = std::memcmp(slot + 5, "\0\0\0\0\0", 5) == 0 && ZipCode::isValid(slot, 5);
+					}
+					else {
+						isValid = ZipCode::isValid(slot, SLOT_SIZE);
+					}
+
+					record(i, isValid, slot, valid, zips);
+					validCount += isValid;
+				}
+				return validCount;
+			}
+
+			// applies the rules to every slot of a block
+			inline std::size_t validateBlock(const Masks & masks, const char * slots, std::size_t first, std::uint8_t * valid, Packed * zips) noexcept {
+				std::size_t validCount = 0;
+				for (std::size_t slot = 0; slot < BLOCK_SLOTS; ++slot) {
+					const bool isValid = isValidSlot(masks, static_cast<unsigned>(slot * SLOT_SIZE));
+					record(first + slot, isValid, slots + (first + slot) * SLOT_SIZE, valid, zips);
+					validCount += isValid;
+				}
+				return validCount;
+			}
+
+#ifdef UTILITIES_SIMD_X86
+			__attribute__((target("sse2")))
+			std::size_t validateSse2(const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips) noexcept {
+				const __m128i zero   = _mm_setzero_si128();
+				const __m128i digit0 = _mm_set1_epi8('0');
+				const __m128i digit9 = _mm_set1_epi8('9');
+				const __m128i nine   = _mm_set1_epi8(9);
+				const __m128i hyphen = _mm_set1_epi8('-');
+
+				std::size_t validCount = 0;
+				std::size_t i = 0;
+				for (; (count - i) * SLOT_SIZE >= BLOCK_BYTES; i += BLOCK_SLOTS) {
+					const char * block = slots + i * SLOT_SIZE;
+
+					Masks masks{};
+					for (unsigned part = 0; part < BLOCK_BYTES / 16; ++part) {
+						const __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + part * 16));
+						// characters below '0' wrap around, so "text - '0' <= 9" (unsigned) finds the digits
+						const __m128i isDigit = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(text, digit0), nine), zero);
+						const unsigned shift = part * 16;
+
+						masks.digits  |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(isDigit))) << shift;
+						masks.zeros   |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(text, digit0)))) << shift;
+						masks.nines   |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(text, digit9)))) << shift;
+						masks.nuls    |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(text, zero)))) << shift;
+						masks.hyphens |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(text, hyphen)))) << shift;
+					}
+
+					validCount += validateBlock(masks, slots, i, valid, zips);
+				}
+
+				return validCount + validateScalar(slots, i, count, valid, zips);
+			}
+
+			__attribute__((target("avx2")))
+			std::size_t validateAvx2(const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips) noexcept {
+				const __m256i zero   = _mm256_setzero_si256();
+				const __m256i digit0 = _mm256_set1_epi8('0');
+				const __m256i digit9 = _mm256_set1_epi8('9');
+				const __m256i nine   = _mm256_set1_epi8(9);
+				const __m256i hyphen = _mm256_set1_epi8('-');
+
+				std::size_t validCount = 0;
+				std::size_t i = 0;
+				for (; (count - i) * SLOT_SIZE >= BLOCK_BYTES; i += BLOCK_SLOTS) {
+					const char * block = slots + i * SLOT_SIZE;
+
+					Masks masks{};
+					for (unsigned part = 0; part < BLOCK_BYTES / 32; ++part) {
+						const __m256i text = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + part * 32));
+						const __m256i isDigit = _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(text, digit0), nine), zero);
+						const unsigned shift = part * 32;
+
+						masks.digits  |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(isDigit))) << shift;
+						masks.zeros   |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(text, digit0)))) << shift;
+						masks.nines   |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(text, digit9)))) << shift;
+						masks.nuls    |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(text, zero)))) << shift;
+						masks.hyphens |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(text, hyphen)))) << shift;
+					}
+
+					validCount += validateBlock(masks, slots, i, valid, zips);
+				}
+
+				return validCount + validateScalar(slots, i, count, valid, zips);
+			}
+#endif
+		}
+
+		/***********************
+		* batch validation
+		**********************/
+		std::size_t validate(const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips) noexcept {
+			return validate(slots, count, valid, zips, Utilities::Simd::available());
+		}
+
+		std::size_t validate(const char * slots, std::size_t count, std::uint8_t * valid, Packed * zips, Utilities::Simd::Isa isa) noexcept {
+			using Utilities::Simd::Isa;
+
+			if (count == 0) {
+				return 0;  // valid and zips may be null
+			}
+			std::memset(valid, 0, (count + 7) / 8);
+
+			// never use more than the processor has
+			switch (Utilities::Simd::clamp(isa)) {
+#ifdef UTILITIES_SIMD_X86
+				case Isa::AVX2:  return validateAvx2(slots, count, valid, zips);
+				case Isa::SSE2:  return validateSse2(slots, count, valid, zips);
+#endif
+				default:         return validateScalar(slots, 0, count, valid, zips);
+			}
+		}
+	}
+}
@@ -0,0 +1,219 @@
+/**
+ * File: ZipIndex.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the ZipIndex class.
+ **/
+
+#include <algorithm>
+
+#include "Addresses/ZipIndex.hpp"
+
+namespace Addresses {
+	namespace {
+		std::uint64_t entry(ZipCode::Packed zip, ZipIndex::RecordId id) noexcept {
+			return std::uint64_t{zip} << 32 | id;
+		}
+
+		inline void prefetch(const void * address) noexcept {
+#if defined(__GNUC__)
+			__builtin_prefetch(address);
+#else
+			static_cast<void>(address);  // only a hint
+#endif
+		}
+
+		// one more than the number of trailing one bits in k
+		inline unsigned pastTrailingOnes(std::size_t k) noexcept {
+#if defined(__GNUC__)
+			return static_cast<unsigned>(__builtin_ffsll(static_cast<long long>(~static_cast<unsigned long long>(k))));
+#else
+			unsigned bits = 1;
+			for (; k & 1; k >>= 1) {
+				++bits;
+			}
+			return bits;
+#endif
+		}
+
+		// an in order walk of the Eytzinger tree visits its nodes in sorted order, so node k gets the next block
+		std::uint32_t fill(std::vector<ZipCode::Packed> & tree, std::vector<std::uint32_t> & blockOf,
+			const std::vector<ZipCode::Packed> & keys, std::size_t blockKeys, std::size_t k, std::uint32_t next) {
+			if (k < tree.size()) {
+				next = fill(tree, blockOf, keys, blockKeys, 2 * k, next);
+				tree[k]    = keys[next * blockKeys];
+				blockOf[k] = next++;
+				next = fill(tree, blockOf, keys, blockKeys, 2 * k + 1, next);
+			}
+			return next;
+		}
+	}
+
+	constexpr std::size_t ZipIndex::BLOCK_KEYS;
+	constexpr std::size_t ZipIndex::MIN_PENDING;
+
+
+	/**********************
+	* Constructors
+	**********************/
+	ZipIndex::ZipIndex(const std::vector<Address> & addresses) {
+		std::vector<std::uint64_t> entries;
+		entries.reserve(addresses.size());
+		for (std::size_t i = 0; i < addresses.size(); ++i) {
+			const ZipCode::Packed zip = addresses[i].packedZipCode();
+			if (zip != ZipCode::NONE) {
+				entries.push_back(entry(zip, static_cast<RecordId>(i)));
+			}
+		}
+		std::sort(entries.begin(), entries.end());
+		build(entries);
+	}
+
+	ZipIndex::ZipIndex(const AddressTable & table) {
+		const auto & zips = table.zipCodes();
+		std::vector<std::uint64_t> entries;
+		entries.reserve(zips.size());
+		for (std::size_t row = 0; row < zips.size(); ++row) {
+			if (zips[row] != ZipCode::NONE) {
+				entries.push_back(entry(zips[row], static_cast<RecordId>(row)));
+			}
+		}
+		std::sort(entries.begin(), entries.end());
+		build(entries);
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	std::vector<ZipIndex::RecordId> ZipIndex::prefix(const std::string & zipPrefix) const {
+		std::vector<RecordId> ids;
+
+		ZipCode::Packed first;
+		ZipCode::Packed last;
+		if (ZipCode::prefixRange(zipPrefix.data(), zipPrefix.length(), first, last)) {
+			ids.reserve(count(first, last));
+			forEach(first, last, [&ids](RecordId id, ZipCode::Packed) { ids.push_back(id); });
+		}
+		return ids;
+	}
+
+	std::vector<ZipIndex::RecordId> ZipIndex::range(std::uint32_t firstZip5, std::uint32_t lastZip5) const {
+		std::vector<RecordId> ids;
+
+		lastZip5 = std::min<std::uint32_t>(lastZip5, 99999);
+		if (firstZip5 <= lastZip5) {
+			const ZipCode::Packed first = std::max<std::uint32_t>(firstZip5, 1) << ZipCode::PLUS4_BITS;
+			const ZipCode::Packed last  = (lastZip5 << ZipCode::PLUS4_BITS) | ((ZipCode::Packed{1} << ZipCode::PLUS4_BITS) - 1);
+			ids.reserve(count(first, last));
+			forEach(first, last, [&ids](RecordId id, ZipCode::Packed) { ids.push_back(id); });
+		}
+		return ids;
+	}
+
+	std::size_t ZipIndex::count(ZipCode::Packed first, ZipCode::Packed last) const noexcept {
+		if (first > last) {
+			return 0;
+		}
+
+		const std::size_t end = last == UINT32_MAX ? _keys.size() : lowerBound(last + 1);
+		const auto pending = std::count_if(_pending.begin(), _pending.end(), [first, last](std::uint64_t added) {
+			return added >= entry(first, 0) && added <= entry(last, UINT32_MAX);
+		});
+		return end - lowerBound(first) + static_cast<std::size_t>(pending);
+	}
+
+	std::size_t ZipIndex::size() const noexcept {
+		return _keys.size() + _pending.size();
+	}
+
+	bool ZipIndex::empty() const noexcept {
+		return size() == 0;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	void ZipIndex::insert(ZipCode::Packed zip, RecordId id) {
+		if (zip == ZipCode::NONE) {
+			return;
+		}
+
+		_pending.push_back(entry(zip, id));
+		if (_pending.size() > std::max(MIN_PENDING, _keys.size() / 256)) {
+			merge();
+		}
+	}
+
+	void ZipIndex::insert(const Address & address, RecordId id) {
+		insert(address.packedZipCode(), id);
+	}
+
+	void ZipIndex::clear() {
+		_keys.clear();
+		_ids.clear();
+		_tree.clear();
+		_blockOf.clear();
+		_pending.clear();
+	}
+
+
+	/**********************
+	* Search and build
+	**********************/
+	std::size_t ZipIndex::lowerBound(ZipCode::Packed key) const noexcept {
+		if (_keys.empty()) {
+			return 0;
+		}
+
+		// descend to a leaf, prefetching the node four levels down:  nodes 16k through 16k + 15 share a cache line
+		const std::size_t nodes = _tree.size() - 1;
+		std::size_t k = 1;
+		while (k <= nodes) {
+			prefetch(_tree.data() + std::min(k * BLOCK_KEYS, nodes));
+			k = 2 * k + (_tree[k] < key);
+		}
+
+		// the last left turn was at the first block starting at or after key; zero if there was none
+		k >>= pastTrailingOnes(k);
+		const std::size_t block = k == 0 ? nodes : _blockOf[k];
+
+		// key's lower bound is past the previous block's first key and no later than this block's
+		std::size_t       position = block == 0 ? 0 : (block - 1) * BLOCK_KEYS;
+		const std::size_t end      = std::min(block * BLOCK_KEYS, _keys.size());
+		while (position < end && _keys[position] < key) {
+			++position;
+		}
+		return position;
+	}
+
+	void ZipIndex::build(const std::vector<std::uint64_t> & entries) {
+		_keys.resize(entries.size());
+		_ids.resize(entries.size());
+		for (std::size_t i = 0; i < entries.size(); ++i) {
+			_keys[i] = static_cast<ZipCode::Packed>(entries[i] >> 32);
+			_ids[i]  = static_cast<RecordId>(entries[i]);
+		}
+
+		const std::size_t blocks = (entries.size() + BLOCK_KEYS - 1) / BLOCK_KEYS;
+		_tree.assign(blocks + 1, 0);
+		_blockOf.assign(blocks + 1, 0);
+		fill(_tree, _blockOf, _keys, BLOCK_KEYS, 1, 0);
+	}
+
+	void ZipIndex::merge() {
+		std::vector<std::uint64_t> entries;
+		entries.reserve(_keys.size() + _pending.size());
+		for (std::size_t i = 0; i < _keys.size(); ++i) {
+			entries.push_back(entry(_keys[i], _ids[i]));
+		}
+		std::sort(_pending.begin(), _pending.end());
+		const auto middle = entries.insert(entries.end(), _pending.begin(), _pending.end());
+		std::inplace_merge(entries.begin(), middle, entries.end());
+
+		build(entries);
+		_pending.clear();
+	}
+}
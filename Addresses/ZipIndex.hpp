@@ -0,0 +1,140 @@
+/**
+ * File: ZipIndex.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the ZipIndex class, a secondary index over a
+ *				collection of addresses keyed on the packed zip code (ZipCode::Packed, the
+ *				5 digit zip and the +4).  It answers "zip codes starting with 926" and "zip
+ *				codes 90620 through 90630" with the Ids of the matching records, in zip
+ *				code order, without touching the records.  A record Id is whatever the
+ *				caller numbers records by:  a vector index, an AddressTable::RowId, a
+ *				Registry::AddressId.
+ *
+ *				Entries live in a sorted array of keys with a parallel array of Ids.
+ *				Searches first walk a small tree of every block's first key, stored in
+ *				Eytzinger (breadth first) order so the next levels to visit are adjacent
+ *				and can be prefetched, then scan one 64 byte block of keys.  Inserts are
+ *				appended to a small buffer that queries also scan, and which is sorted and
+ *				merged into the array once it holds about 1/256 of the entries.
+ *
+ *				Addresses without a zip code are not indexed.
+ *
+ *				Usage:
+ *				        Addresses::ZipIndex index(addresses);
+ *				        for (auto id : index.prefix("926"))      ...  addresses[id]  ...
+ *				        for (auto id : index.range(90620, 90630)) ...
+ **/
+
+#ifndef ADDRESSES_ZipIndex_hpp
+#define ADDRESSES_ZipIndex_hpp
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressTable.hpp"
+#include "Addresses/ZipCode.hpp"
+
+
+
+
+namespace Addresses
+{
+  class ZipIndex
+  {
+    public:
+      using RecordId = std::uint32_t;
+
+
+      // Constructors and Destructor
+      ZipIndex             (                   )          = default;
+      ZipIndex             ( const ZipIndex &  )          = default;
+      ZipIndex             (       ZipIndex && )          = default;
+      ZipIndex & operator= ( const ZipIndex &  )          = default;
+      ZipIndex & operator= (       ZipIndex && )          = default;
+     ~ZipIndex             (                   ) noexcept = default;
+
+      explicit ZipIndex( const std::vector<Address> & addresses );   // Ids are positions in the vector
+      explicit ZipIndex( const AddressTable &         table     );   // Ids are RowIds, read from the zip code column only
+
+
+      // Queries - Ids in zip code order, and in Id order within a zip code.  Returns no Ids if zipPrefix is not 0 to 5 digits.
+      std::vector<RecordId>  prefix  ( const std::string & zipPrefix                   ) const;   // "926" is 92600 through 92699
+      std::vector<RecordId>  range   ( std::uint32_t firstZip5, std::uint32_t lastZip5 ) const;   // inclusive, any +4
+
+      // Every entry with first <= zip <= last:  visit(RecordId, ZipCode::Packed), in the order above
+      template <typename Visit>
+      void                   forEach ( ZipCode::Packed first, ZipCode::Packed last, Visit visit ) const;
+      std::size_t            count   ( ZipCode::Packed first, ZipCode::Packed last              ) const noexcept;
+
+      std::size_t            size    () const noexcept;
+      bool                   empty   () const noexcept;
+
+
+      // Modifiers - an Id inserted twice is found twice.  Inserting NONE does nothing.
+      void                   insert  ( ZipCode::Packed zip,      RecordId id );
+      void                   insert  ( const Address & address,  RecordId id );
+      void                   clear   ();
+
+
+
+
+    private:
+      std::size_t  lowerBound ( ZipCode::Packed key                       ) const noexcept;   // first position in _keys with a key >= key
+      void         build      ( const std::vector<std::uint64_t> & entries );                  // entries are (zip << 32 | id), sorted
+      void         merge      (                                           );                  // moves _pending into the array
+
+      // Instance attribute (aka object state attributes)
+      std::vector<ZipCode::Packed>   _keys;      // sorted, with _ids by position
+      std::vector<RecordId>          _ids;
+      std::vector<ZipCode::Packed>   _tree;      // first key of each block of _keys, Eytzinger order from index 1
+      std::vector<std::uint32_t>     _blockOf;   // block number of each _tree entry
+      std::vector<std::uint64_t>     _pending;   // inserted since the last merge, (zip << 32 | id), in insertion order
+
+      // Class attributes
+      static constexpr std::size_t BLOCK_KEYS  = 16;     // one cache line of keys
+      static constexpr std::size_t MIN_PENDING = 1024;   // inserts held before a merge, at least
+  };  // class ZipIndex
+
+
+
+
+  // Template definitions
+  template <typename Visit>
+  void ZipIndex::forEach( ZipCode::Packed first, ZipCode::Packed last, Visit visit ) const
+  {
+    if( first > last )  return;
+
+    // the pending entries in range, sorted by (zip, id) like the array, so the two can be merged
+    std::vector<std::uint64_t> matching;
+    for( const std::uint64_t added : _pending )
+    {
+      if( added >= ( std::uint64_t{ first } << 32 )  &&  added <= ( std::uint64_t{ last } << 32 | UINT32_MAX ) )  matching.push_back( added );
+    }
+    std::sort( matching.begin(), matching.end() );
+
+    std::size_t position   = lowerBound( first );
+    auto        pending    = matching.cbegin();
+    const auto  pendingEnd = matching.cend();
+
+    while( position < _keys.size()  &&  _keys[position] <= last )
+    {
+      const std::uint64_t entry = std::uint64_t{ _keys[position] } << 32 | _ids[position];
+      for( ; pending != pendingEnd  &&  *pending < entry; ++pending )
+      {
+        visit( static_cast<RecordId>( *pending ), static_cast<ZipCode::Packed>( *pending >> 32 ) );
+      }
+      visit( _ids[position], _keys[position] );
+      ++position;
+    }
+    for( ; pending != pendingEnd; ++pending )
+    {
+      visit( static_cast<RecordId>( *pending ), static_cast<ZipCode::Packed>( *pending >> 32 ) );
+    }
+  }
+} // namespace Addresses
+#endif
@@ -0,0 +1,129 @@
+/**
+ * File: DirectoryBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures fuzzy employee name search:  comparing a misspelled name to
+ *				every last name on the roster by edit distance, against Directory::search(),
+ *				and posting list intersection with each instruction set.
+ *
+ * Usage:  DirectoryBenchmark [employees]
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Employees/Directory.hpp"
+#include "Employees/Employee.hpp"
+#include "Utilities/Postings.hpp"
+#include "Utilities/Simd.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  std::string makeName( std::mt19937 & random )
+  {
+    const char * syllables[] = { "an", "ber", "co", "da", "el", "fi", "gar", "ho", "is", "jo", "ka", "li", "mo", "ne", "or", "pe",
+                                 "qui", "ra", "son", "ta", "ul", "vi", "wes", "xa", "yo", "zel" };
+    std::string name;
+    for( unsigned s = 0, count = 2 + random() % 3; s < count; ++s )  name += syllables[random() % 26];
+    name[0] = static_cast<char>( name[0] - 'a' + 'A' );
+    return name;
+  }
+
+  // a one character typo
+  std::string misspell( std::string name, std::mt19937 & random )
+  {
+    const std::size_t at = random() % name.size();
+    switch( random() % 3 )
+    {
+      case 0:   name.erase( at, 1 );                                        break;
+      case 1:   name.insert( at, 1, static_cast<char>( 'a' + random() % 26 ) ); break;
+      default:  name[at] = static_cast<char>( 'a' + random() % 26 );          break;
+    }
+    return name;
+  }
+
+  std::size_t editDistance( const std::string & lhs, const std::string & rhs )
+  {
+    std::vector<std::size_t> row( rhs.size() + 1 );
+    for( std::size_t j = 0; j <= rhs.size(); ++j )  row[j] = j;
+    for( std::size_t i = 1; i <= lhs.size(); ++i )
+    {
+      std::size_t diagonal = row[0];
+      row[0] = i;
+      for( std::size_t j = 1; j <= rhs.size(); ++j )
+      {
+        const std::size_t above = row[j];
+        row[j] = std::min( { row[j] + 1, row[j - 1] + 1, diagonal + ( lhs[i - 1] != rhs[j - 1] ) } );
+        diagonal = above;
+      }
+    }
+    return row[rhs.size()];
+  }
+
+  template <typename Function>
+  double microseconds( std::size_t repeat, Function function )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for( std::size_t i = 0; i < repeat; ++i )  function( i );
+    return std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now() - start ).count() / static_cast<double>( repeat );
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const std::size_t count = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1000000;
+
+  std::mt19937 random( 1 );
+  std::vector<Employees::Employee> roster;
+  roster.reserve( count );
+  for( std::size_t i = 0; i < count; ++i )  roster.emplace_back( makeName( random ), makeName( random ) );
+
+  const auto start = std::chrono::steady_clock::now();
+  const Employees::Directory directory( roster );
+  std::cout << count << " employees, directory built in "
+            << std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count() << " s, "
+            << directory.bytes() / ( 1024 * 1024 ) << " MB of posting lists\n\n";
+
+  std::vector<std::string> queries;
+  for( int i = 0; i < 20; ++i )  queries.push_back( misspell( roster[random() % count].lastName(), random ) );
+
+  std::size_t found = 0;  // consumed below so the work is not optimized away
+  std::cout << "edit distance scan:  " << microseconds( 2, [&]( std::size_t q )
+  {
+    for( const auto & employee : roster )  found += editDistance( queries[q], employee.lastName() ) <= 1;
+  } ) << " us per query\n";
+  std::cout << "Directory::search:   " << microseconds( queries.size(), [&]( std::size_t q )
+  {
+    found += directory.search( queries[q], 10 ).size();
+  } ) << " us per query\n\n";
+
+  // two lists of about a quarter and a half of the roster
+  std::vector<std::uint32_t> lhs, rhs, out( count );
+  for( std::uint32_t id = 0; id < count; ++id )
+  {
+    if( random() % 4 == 0 )  lhs.push_back( id );
+    if( random() % 2 == 0 )  rhs.push_back( id );
+  }
+  for( auto isa : { Utilities::Simd::Isa::SCALAR, Utilities::Simd::Isa::SSE2, Utilities::Simd::Isa::AVX2 } )
+  {
+    if( Utilities::Simd::clamp( isa ) != isa )  continue;
+    const char * name = isa == Utilities::Simd::Isa::AVX2 ? "AVX2  " : isa == Utilities::Simd::Isa::SSE2 ? "SSE2  " : "scalar";
+    std::cout << "intersect " << name << ":    " << microseconds( 20, [&]( std::size_t )
+    {
+      found += Utilities::Postings::intersect( lhs.data(), lhs.size(), rhs.data(), rhs.size(), out.data(), isa );
+    } ) << " us for " << lhs.size() << " x " << rhs.size() << " Ids\n";
+  }
+  std::cout << "\n(" << found << ")\n";
+}
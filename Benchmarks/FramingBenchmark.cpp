@@ -0,0 +1,131 @@
+/**
+ * File: FramingBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures record framing throughput in GB/s over an in memory buffer of
+ *				address records:  the std::getline() loops the extraction operators used to
+ *				run, the offset index (findSeparators) and full record and field framing
+ *				(forEachRecord) with each instruction set.
+ *
+ * Usage:  FramingBenchmark [megabytes]
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Utilities/RecordFramer.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/Simd.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  std::string makeRecords( std::size_t bytes )
+  {
+    const char * cities[] = { "Spokane", "Cincinnati", "Anaheim", "Buena Park", "Fullerton" };
+    const char * states[] = { "Washington", "Ohio", "California", "California", "California" };
+
+    std::string text;
+    text.reserve( bytes + 100 );
+    for( unsigned long i = 0; text.size() < bytes; ++i )
+    {
+      text += std::to_string( i % 20000 ) + " S. Harbor Boulevard";
+      text += Utilities::Records::FIELD_SEPARATOR;
+      text += cities[i % 5];
+      text += Utilities::Records::FIELD_SEPARATOR;
+      text += states[i % 5];
+      text += Utilities::Records::FIELD_SEPARATOR;
+      text += std::to_string( 10000 + i % 89999 ) + "-1234";
+      text += Utilities::Records::RECORD_SEPARATOR;
+    }
+    return text;
+  }
+
+
+
+  // best of several runs, in GB/s
+  template <typename Function>
+  void measure( const std::string & label, const std::string & text, Function frame )
+  {
+    double      best   = 0.0;
+    std::size_t result = 0;  // consumed below so the work is not optimized away
+    for( int run = 0; run < 5; ++run )
+    {
+      const auto start = std::chrono::steady_clock::now();
+      result = frame( text );
+      const auto stop  = std::chrono::steady_clock::now();
+
+      best = std::max( best, static_cast<double>( text.size() ) / std::chrono::duration<double>( stop - start ).count() / 1e9 );
+    }
+    std::cout << label << ":  " << best << " GB/s  (" << result << ")\n";
+  }
+
+  const char * name( Utilities::Simd::Isa isa )
+  {
+    switch( isa )
+    {
+      case Utilities::Simd::Isa::AVX2:  return "AVX2  ";
+      case Utilities::Simd::Isa::SSE2:  return "SSE2  ";
+      default:                          return "scalar";
+    }
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  using namespace Utilities;
+
+  const std::size_t megabytes = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 256;
+  const std::string text      = makeRecords( megabytes * 1024 * 1024 );
+
+  std::cout << "Framing " << text.size() / ( 1024 * 1024 ) << " MB of address records\n\n";
+
+  measure( "std::getline records + fields (old operator>>)", text, []( const std::string & records )
+  {
+    std::istringstream stream( records );
+    std::string        record;
+    std::string        field;
+    std::size_t        fields = 0;
+    while( std::getline( stream, record, Records::RECORD_SEPARATOR ) )
+    {
+      std::istringstream recordStream( record );
+      while( std::getline( recordStream, field, Records::FIELD_SEPARATOR ) )  ++fields;
+    }
+    return fields;
+  } );
+
+  for( auto isa : { Simd::Isa::SCALAR, Simd::Isa::SSE2, Simd::Isa::AVX2 } )
+  {
+    if( Simd::clamp( isa ) != isa )  continue;
+
+    measure( std::string( "findSeparators (offset index)   " ) + name( isa ), text, [isa]( const std::string & records )
+    {
+      constexpr std::size_t      CHUNK_SIZE = 256 * 1024;
+      std::vector<std::uint32_t> offsets( CHUNK_SIZE );
+      std::size_t                found = 0;
+      for( std::size_t chunk = 0; chunk < records.size(); chunk += CHUNK_SIZE )
+      {
+        found += Records::findSeparators( records.data() + chunk, std::min( CHUNK_SIZE, records.size() - chunk ), offsets.data(), isa );
+      }
+      return found;
+    } );
+
+    measure( std::string( "forEachRecord (records + fields) " ) + name( isa ), text, [isa]( const std::string & records )
+    {
+      std::size_t fields = 0;
+      Records::forEachRecord( records, [&fields]( StringView, const Records::Fields & f ) { fields += f.count; }, isa );
+      return fields;
+    } );
+  }
+}
@@ -0,0 +1,101 @@
+/**
+ * File: PresortBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures sorting a mailing list of random addresses:  std::sort with
+ *				Addresses::operator< and with the presort comparison, the collation key sort,
+ *				and the radix presort over a vector and over an AddressTable with one and
+ *				with every hardware thread.
+ *
+ * Usage:  PresortBenchmark [records]      (default 10,000,000)
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressTable.hpp"
+#include "Addresses/Collation.hpp"
+#include "Addresses/Presort.hpp"
+#include "Utilities/ParallelLoader.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  std::vector<Addresses::Address> makeAddresses( std::size_t count )
+  {
+    const char * states[]  = { "CA", "OH", "WA", "TX", "NY", "FL", "IL", "PA" };
+    const char * streets[] = { "Main Street", "Harbor Boulevard", "Vine Street", "Howard Street", "Oak Avenue", "Elm Court" };
+
+    std::mt19937 random( 2015 );
+    std::vector<Addresses::Address> addresses;
+    addresses.reserve( count );
+    for( std::size_t i = 0; i < count; ++i )
+    {
+      addresses.emplace_back( std::to_string( random() % 10000 ) + ' ' + streets[random() % 6],
+                              "City " + std::to_string( random() % 5000 ),
+                              states[random() % 8],
+                              10000 + random() % 89999 );
+      if( random() % 2 )  addresses.back().packedZipCode( addresses.back().packedZipCode() | ( 1 + random() % 9998 ) );
+    }
+    return addresses;
+  }
+
+
+
+  template <typename Function>
+  void measure( const std::string & label, Function sort )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    sort();
+    const auto stop  = std::chrono::steady_clock::now();
+
+    std::cout << std::left << std::setw( 45 ) << label << std::chrono::duration<double>( stop - start ).count() << " s\n";
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const std::size_t count   = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 10000000;
+  const std::size_t threads = Utilities::defaultThreadCount();
+
+  const std::vector<Addresses::Address> addresses = makeAddresses( count );
+  const Addresses::AddressTable         table( addresses );
+
+  std::cout << "Sorting " << count << " addresses\n\n";
+
+  {
+    std::vector<Addresses::Address> copy = addresses;
+    measure( "std::sort, operator<", [&copy] { std::sort( copy.begin(), copy.end() ); } );
+  }
+  {
+    std::vector<Addresses::Address> copy = addresses;
+    measure( "std::sort, presort comparison", [&copy] { std::sort( copy.begin(), copy.end(), Addresses::Presort::before ); } );
+  }
+  {
+    std::vector<Addresses::Address> copy = addresses;
+    measure( "Collation::sort (operator< order)", [&copy] { Addresses::Collation::sort( copy ); } );
+  }
+  {
+    std::vector<Addresses::Address> copy = addresses;
+    measure( "Presort::sort, 1 thread", [&copy] { Addresses::Presort::sort( copy, 1 ); } );
+  }
+  {
+    std::vector<Addresses::Address> copy = addresses;
+    measure( "Presort::sort, " + std::to_string( threads ) + " thread(s)", [&copy, threads] { Addresses::Presort::sort( copy, threads ); } );
+  }
+
+  measure( "Presort::order, AddressTable, 1 thread", [&table] { Addresses::Presort::order( table, 1 ); } );
+  measure( "Presort::order, AddressTable, " + std::to_string( threads ) + " thread(s)", [&table, threads] { Addresses::Presort::order( table, threads ); } );
+}
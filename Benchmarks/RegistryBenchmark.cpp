@@ -0,0 +1,184 @@
+/**
+ * File: RegistryBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures read throughput of a ConcurrentRegistry with 1 to 32 reader
+ *				threads while a writer streams batches of employee transfers.  Each read
+ *				follows an employee to their employer and its headquarters address, and
+ *				checks the employee is on the employer's list in the same snapshot, so the
+ *				run is also a stress test:  it fails if a reader ever sees a partly applied
+ *				batch.  Readers either keep a Reader or take a snapshot() for every read.
+ *
+ * Usage:  RegistryBenchmark [employees] [milliseconds per run] [transfers per batch]
+ **/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MailSystem/ConcurrentRegistry.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  using MailSystem::ConcurrentRegistry;
+  using MailSystem::Registry;
+
+  MailSystem::Registry makeRegistry( std::size_t employees )
+  {
+    const char * states[] = { "WA", "OH", "CA", "TX", "NY" };
+
+    const std::size_t companies = std::max<std::size_t>( employees / 100, 1 );
+    Registry registry;
+    registry.reserve( companies, companies, employees );
+    for( std::size_t c = 0; c < companies; ++c )
+    {
+      const auto hq = registry.add( Addresses::Address( std::to_string( c ) + " S. Harbor Boulevard", "Fullerton", states[c % 5], 10000 + c % 89999 ) );
+      registry.add( Companies::Company( "Company " + std::to_string( c ) ), hq );
+    }
+    for( std::size_t e = 0; e < employees; ++e )
+    {
+      registry.add( Employees::Employee( "First" + std::to_string( e ), "Last" + std::to_string( e % 1000 ) ), static_cast<Registry::CompanyId>( e % companies ) );
+    }
+    return registry;
+  }
+
+
+
+  // one read:  employee, employer, headquarters, and the employer's list checked against the employee
+  bool read( const Registry & registry, Registry::EmployeeId employee, std::size_t & touched )
+  {
+    const auto   company = registry.employerOf( employee );
+    const auto & staff   = registry.employeesOf( company );
+    touched += registry.employee( employee ).lastNameView().size() + registry.address( registry.headquartersOf( company ) ).stateOrdinal();
+    return std::binary_search( staff.begin(), staff.end(), employee );
+  }
+
+
+
+  struct Result
+  {
+    double         readsPerSecond = 0;
+    std::uint64_t  versions       = 0;
+    std::uint64_t  inconsistent   = 0;
+  };
+
+  template <typename ReadLoop>
+  Result run( ConcurrentRegistry & shared, unsigned threads, std::chrono::milliseconds duration, std::size_t batchSize, ReadLoop readLoop )
+  {
+    std::atomic<bool>           stop( false );
+    std::atomic<std::uint64_t>  reads( 0 );
+    std::atomic<std::uint64_t>  inconsistent( 0 );
+
+    const std::uint64_t firstVersion = shared.version();
+    std::thread writer( [&]()
+    {
+      std::mt19937 random( 1 );
+      while( !stop.load( std::memory_order_relaxed ) )
+      {
+        shared.update( [&]( Registry & registry )
+        {
+          for( std::size_t i = 0; i < batchSize; ++i )
+          {
+            registry.transfer( static_cast<Registry::EmployeeId>( random() % registry.employeeCount() ),
+                               static_cast<Registry::CompanyId>( random() % registry.companyCount() ) );
+          }
+        } );
+      }
+    } );
+
+    std::vector<std::thread> readers;
+    std::atomic<std::size_t> sink( 0 );  // consumed so the reads are not optimized away
+    const auto start = std::chrono::steady_clock::now();
+    for( unsigned t = 0; t < threads; ++t )
+    {
+      readers.emplace_back( [&, t]()
+      {
+        std::uint64_t count = 0, bad = 0;
+        std::size_t   touched = 0;
+        readLoop( stop, t, count, bad, touched );
+        reads += count;
+        inconsistent += bad;
+        sink += touched;
+      } );
+    }
+
+    std::this_thread::sleep_for( duration );
+    stop = true;
+    for( auto & reader : readers )  reader.join();
+    const auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    writer.join();
+
+    Result result;
+    result.readsPerSecond = static_cast<double>( reads ) / seconds;
+    result.versions       = shared.version() - firstVersion;
+    result.inconsistent   = inconsistent + ( sink == 0 );
+    return result;
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const std::size_t employees    = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 100000;
+  const auto        duration     = std::chrono::milliseconds( argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 1000 );
+  const std::size_t batchSize    = argc > 3 ? std::strtoul( argv[3], nullptr, 10 ) : 1000;
+
+  ConcurrentRegistry shared( makeRegistry( std::max<std::size_t>( employees, 1 ) ) );
+  const auto employeeCount = static_cast<Registry::EmployeeId>( shared.snapshot()->employeeCount() );
+
+  std::cout << employeeCount << " employees, " << shared.snapshot()->companyCount() << " companies, "
+            << batchSize << " transfers per batch, " << duration.count() << " ms per run\n\n"
+            << "threads   Reader reads/s   snapshot() reads/s   versions published\n";
+
+  std::uint64_t inconsistent = 0;
+  for( unsigned threads : { 1u, 2u, 4u, 8u, 16u, 32u } )
+  {
+    const Result cached = run( shared, threads, duration, batchSize,
+      [&]( const std::atomic<bool> & stop, unsigned seed, std::uint64_t & count, std::uint64_t & bad, std::size_t & touched )
+      {
+        std::mt19937 random( seed );
+        ConcurrentRegistry::Reader reader( shared );
+        while( !stop.load( std::memory_order_relaxed ) )
+        {
+          const Registry & registry = reader.current();
+          for( int i = 0; i < 64; ++i, ++count )  bad += !read( registry, random() % employeeCount, touched );
+        }
+      } );
+
+    const Result loaded = run( shared, threads, duration, batchSize,
+      [&]( const std::atomic<bool> & stop, unsigned seed, std::uint64_t & count, std::uint64_t & bad, std::size_t & touched )
+      {
+        std::mt19937 random( seed );
+        while( !stop.load( std::memory_order_relaxed ) )
+        {
+          for( int i = 0; i < 64; ++i, ++count )  bad += !read( *shared.snapshot(), random() % employeeCount, touched );
+        }
+      } );
+
+    std::cout << std::fixed << std::setprecision( 2 )
+              << std::setw( 7 )  << threads
+              << std::setw( 16 ) << cached.readsPerSecond / 1e6 << "M"
+              << std::setw( 20 ) << loaded.readsPerSecond / 1e6 << "M"
+              << std::setw( 21 ) << cached.versions + loaded.versions << '\n';
+    inconsistent += cached.inconsistent + loaded.inconsistent;
+  }
+
+  if( inconsistent != 0 )
+  {
+    std::cerr << "\nFailure - readers saw " << inconsistent << " inconsistent reads\n";
+    return 1;
+  }
+}
@@ -0,0 +1,133 @@
+/**
+ * File: StateLookupBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures state lookups per second on a mixed workload of state codes and full
+ *				names.  "before" is the original Address::state() algorithm (std::map built per
+ *				call, linear find_if over the names), "after" is the compile time state table.
+ *
+ * Usage:  StateLookupBenchmark [lookups]
+ **/
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <locale>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/States.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  // The state lookup as it was before the state table, minus the exceptions.  Returns "" if the code is not valid.
+  std::string legacyLookup( std::string code )
+  {
+    const std::map<std::string, std::string> states =
+    {
+      { "AL","Alabama" },        { "AK","Alaska" },         { "AZ","Arizona" },        { "AR","Arkansas" },
+      { "CA","California" },     { "CO","Colorado" },       { "CT","Connecticut" },    { "DE","Delaware" },
+      { "FL","Florida" },        { "GA","Georgia" },        { "HI","Hawaii" },         { "ID","Idaho" },
+      { "IL","Illinois" },       { "IN","Indiana" },        { "IA","Iowa" },           { "KS","Kansas" },
+      { "KY","Kentucky" },       { "LA","Louisiana" },      { "ME","Maine" },          { "MD","Maryland" },
+      { "MA","Massachusetts" },  { "MI","Michigan" },       { "MN","Minnesota" },      { "MS","Mississippi" },
+      { "MO","Missouri" },       { "MT","Montana" },        { "NE","Nebraska" },       { "NV","Nevada" },
+      { "NH","New Hampshire" },  { "NJ","New Jersey" },     { "NM","New Mexico" },     { "NY","New York" },
+      { "NC","North Carolina" }, { "ND","North Dakota" },   { "OH","Ohio" },           { "OK","Oklahoma" },
+      { "OR","Oregon" },         { "PA","Pennsylvania" },   { "RI","Rhode Island" },   { "SC","South Carolina" },
+      { "SD","South Dakota" },   { "TN","Tennessee" },      { "TX","Texas" },          { "UT","Utah" },
+      { "VT","Vermont" },        { "VA","Virginia" },       { "WA","Washington" },     { "WV","West Virginia" },
+      { "WI","Wisconsin" },      { "WY","Wyoming" },        { "DC","District of Columbia" },
+    };
+
+    auto toupper = []( char c ) { return std::toupper( c, std::locale() ); };
+    auto tolower = []( char c ) { return std::tolower( c, std::locale() ); };
+
+    if( code.length() == 2 )
+    {
+      std::transform( code.begin(), code.end(), code.begin(), toupper );
+      auto itr = states.find( code );
+      return itr != states.cend() ? itr->second : std::string{};
+    }
+
+    std::transform( code.begin(), code.begin() + 1, code.begin(), toupper );
+    std::transform( code.begin() + 1, code.end(), code.begin() + 1, tolower );
+    auto nameExists = [code, toupper, tolower]( auto value )
+    {
+      std::transform( value.second.begin(), value.second.begin() + 1, value.second.begin(), toupper );
+      std::transform( value.second.begin() + 1, value.second.end(), value.second.begin() + 1, tolower );
+      return value.second == code;
+    };
+    auto itr = std::find_if( states.cbegin(), states.cend(), nameExists );
+    return itr != states.cend() ? itr->second : std::string{};
+  }
+
+
+
+  // Half codes and half names, every one in a random mix of upper and lower case
+  std::vector<std::string> makeWorkload( std::size_t size )
+  {
+    std::mt19937                               random( 20150612 );
+    std::uniform_int_distribution<unsigned>    pickState( 1, Addresses::States::COUNT );
+    std::bernoulli_distribution                coinFlip;
+
+    std::vector<std::string> workload;
+    workload.reserve( size );
+    for( std::size_t i = 0; i < size; ++i )
+    {
+      const auto  state = static_cast<Addresses::States::Ordinal>( pickState( random ) );
+      std::string text  = coinFlip( random ) ? Addresses::States::code( state ) : Addresses::States::name( state );
+      for( auto & c : text )  c = coinFlip( random ) ? static_cast<char>( std::toupper( c ) ) : static_cast<char>( std::tolower( c ) );
+      workload.push_back( std::move( text ) );
+    }
+    return workload;
+  }
+
+
+
+  template <typename Function>
+  void measure( const std::string & label, const std::vector<std::string> & workload, Function lookup )
+  {
+    std::size_t found = 0;  // consumed below so the lookups are not optimized away
+
+    const auto start = std::chrono::steady_clock::now();
+    for( const auto & text : workload )  found += lookup( text );
+    const auto stop  = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>( stop - start ).count();
+    std::cout << label << ":  " << static_cast<std::size_t>( static_cast<double>( workload.size() ) / seconds ) << " lookups/second"
+              << "  (" << found << " of " << workload.size() << " found)\n";
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const std::size_t lookups  = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1000000;
+  const auto        workload = makeWorkload( lookups );
+
+  measure( "before - std::map + find_if     ", workload,
+           []( const std::string & text ) { return !legacyLookup( text ).empty(); } );
+
+  measure( "after  - States perfect hash    ", workload,
+           []( const std::string & text )
+           {
+             const auto state = text.length() == 2 ? Addresses::States::fromCode( text.data(), text.length() )
+                                                   : Addresses::States::fromName( text.data(), text.length() );
+             return state != Addresses::States::NONE;
+           } );
+
+  Addresses::Address address;
+  measure( "after  - Address::state() setter", workload,
+           [&address]( const std::string & text ) { return !address.state( text ).state().empty(); } );
+}
@@ -0,0 +1,102 @@
+/**
+ * File: ZipIndexBenchmark.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Measures zip code prefix queries over a collection of addresses:  a scan
+ *				comparing zipCode().substr(), the AddressTable column scan and a ZipIndex
+ *				lookup, and the cost of building a ZipIndex all at once and one insert at
+ *				a time.
+ *
+ * Usage:  ZipIndexBenchmark [addresses]
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressTable.hpp"
+#include "Addresses/ZipIndex.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  const char * const PREFIXES[] = { "926", "9", "90620", "331", "1" };
+
+  // average over every prefix in PREFIXES, in microseconds per query
+  template <typename Query>
+  void measure( const std::string & label, Query query )
+  {
+    std::size_t found = 0;  // consumed below so the work is not optimized away
+    int         runs  = 0;
+    const auto start = std::chrono::steady_clock::now();
+    do
+    {
+      for( const auto prefix : PREFIXES )  found += query( prefix );
+      ++runs;
+    } while( std::chrono::steady_clock::now() - start < std::chrono::milliseconds( 500 ) );
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double queries = static_cast<double>( runs ) * ( sizeof( PREFIXES ) / sizeof( PREFIXES[0] ) );
+    std::cout << label << ":  " << std::chrono::duration<double, std::micro>( stop - start ).count() / queries
+              << " us per query  (" << found / runs << " found)\n";
+  }
+
+  template <typename Function>
+  double seconds( Function function )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  using namespace Addresses;
+
+  const std::size_t count = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 2000000;
+
+  std::mt19937 random( 1 );
+  std::vector<Address> addresses;
+  addresses.reserve( count );
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    addresses.emplace_back( std::to_string( i % 20000 ) + " S. Harbor Boulevard", "Fullerton", "CA", 1001 + random() % 98000 );
+  }
+  const AddressTable table( addresses );
+
+  ZipIndex index;
+  std::cout << count << " addresses\n\n"
+            << "ZipIndex build:    " << seconds( [&]() { index = ZipIndex( table ); } ) << " s\n";
+
+  ZipIndex grown;
+  const double insertSeconds = seconds( [&]()
+  {
+    for( std::size_t i = 0; i < count; ++i )  grown.insert( table.zipCodes()[i], static_cast<ZipIndex::RecordId>( i ) );
+  } );
+  std::cout << "ZipIndex inserts:  " << insertSeconds / static_cast<double>( count ) * 1e9 << " ns per insert\n\n";
+
+  measure( "zipCode().substr() scan", [&]( const std::string & prefix )
+  {
+    std::size_t found = 0;
+    for( const auto & address : addresses )  found += address.zipCode().substr( 0, prefix.size() ) == prefix;
+    return found;
+  } );
+  measure( "AddressTable::select   ", [&]( const std::string & prefix ) { return table.select( States::NONE, prefix ).size(); } );
+  measure( "ZipIndex::prefix       ", [&]( const std::string & prefix ) { return index.prefix( prefix ).size(); } );
+  measure( "ZipIndex::count        ", [&]( const std::string & prefix )
+  {
+    ZipCode::Packed first, last;
+    ZipCode::prefixRange( prefix.data(), prefix.size(), first, last );
+    return index.count( first, last );
+  } );
+}
@@ -7,8 +7,9 @@
  *				A company consists of a free-text name.
  **/
 
+#include <cstddef>
 #include <string>
-#include <sstream>
+#include <utility>
 #include <iostream>
 
 #include "Companies/Company.hpp"
@@ -17,7 +18,7 @@
 namespace Companies {
 	// Company headquarters is located at the address with this key.
 	Company::Company(std::string name) {
-		this->name(name);
+		this->name(std::move(name));
 	}
 
 
@@ -27,15 +28,47 @@ namespace Companies {
 	std::string Company::name() const noexcept {
 		return _name;
 	}
+	Utilities::StringView Company::nameView() const noexcept {
+		return _name;
+	}
+	std::size_t Company::hash() const noexcept {
+		return static_cast<std::size_t>(_hash.get([this]() { return Utilities::Hash::string(_name); }));
+	}
 
 
 	/**********************
 	* Conversions
 	**********************/
 	Company::operator std::string() const {
-		std::ostringstream oss;
-		oss << *this;
-		return oss.str();
+		std::string record;
+		appendTo(record);
+		return record;
+	}
+	void Company::appendTo(std::string & record) const {
+		Utilities::Records::append(record, { _name });
+	}
+	std::size_t Company::formatTo(char * buffer, std::size_t size) const noexcept {
+		return Utilities::Records::format(buffer, size, { _name });
+	}
+
+
+	/**********************
+	* Binary serialization
+	**********************/
+	void Company::serialize(Utilities::Binary::Buffer & buffer) const {
+		const std::size_t record = buffer.beginRecord(Utilities::Binary::RecordType::COMPANY);
+		buffer.putString(_name);
+		buffer.endRecord(record);
+	}
+
+	Company & Company::deserialize(Utilities::Binary::Reader & reader) {
+		Utilities::Binary::Reader payload = reader.record(Utilities::Binary::RecordType::COMPANY);
+		const Utilities::StringView name  = payload.getString();
+
+		_name.assign(name.data(), name.size());
+		_hash.reset();
+
+		return *this;
 	}
 
 
@@ -43,7 +76,8 @@ namespace Companies {
 	* Modifiers
 	**********************/
 	Company & Company::name(std::string newName)  noexcept {
-		_name = newName;
+		_name = std::move(newName);
+		_hash.reset();
 
 		return *this;
 	}
@@ -53,29 +87,31 @@ namespace Companies {
 	**********************/
 	// reference stream overloads
 	std::ostream & operator<< (std::ostream & s, const Company & company) {
-		s << company.name() <<
-			Company::RECORD_SEPARATOR;
-		return s;
+		return Utilities::Records::write(s, company);
 	}
 	std::istream & operator>> (std::istream & s, Company & company) {
 		// record string
 		std::string record;
 		// try to get the record from the stream
 		if (std::getline(s, record, Company::RECORD_SEPARATOR)) {
-			// convert to stringstream
-			std::stringstream ss(record);
-
-			std::string name;
-
-			// get the data from the stream using the proper delimiter
-			if (std::getline(ss, name, Company::FIELD_SEPARATOR)) {
-
-				// construct the company object
-				company = Company(name);
-			}
+			fromRecord(record, company);
 		}
 		return s;
 	}
+	// record overload
+	bool fromRecord(Utilities::StringView record, Company & company) {
+		return fromRecord(Utilities::Records::split(record), company);
+	}
+	bool fromRecord(const Utilities::Records::Fields & fields, Company & company) {
+		if (fields.count == 0) {
+			return false;
+		}
+
+		// construct the company object
+		const Utilities::StringView & name = fields.field[0];
+		company = Company(std::string(name.data(), name.size()));
+		return true;
+	}
 	// pointer stream overloads
 	std::ostream & operator<< (std::ostream & s, const Company * company) {
 		if (company != nullptr) {
@@ -97,11 +133,11 @@ namespace Companies {
 	 **********************/
 	// equal to
 	bool operator==(const Company & lhs, const Company & rhs) {
-		return lhs.name() == rhs.name();
+		return lhs._name == rhs._name;
 	}
 	// less than
 	bool operator< (const Company & lhs, const Company & rhs) {
-		return lhs.name() < rhs.name();
+		return lhs._name < rhs._name;
 	}
 	// not equal to
 	bool operator!=(const Company & lhs, const Company & rhs) {
@@ -109,14 +145,14 @@ namespace Companies {
 	}
 	// greater than
 	bool operator> (const Company & lhs, const Company & rhs) {
-		return lhs.name() > rhs.name();
+		return lhs.nameView() > rhs.nameView();
 	}
 	// less than or equal
 	bool operator<=(const Company & lhs, const Company & rhs) {
-		return lhs.name() <= rhs.name();
+		return lhs.nameView() <= rhs.nameView();
 	}
 	// greater than or equal
 	bool operator>=(const Company & lhs, const Company & rhs) {
-		return lhs.name() >= rhs.name();
+		return lhs.nameView() >= rhs.nameView();
 	}
 }
\ No newline at end of file
@@ -25,10 +25,15 @@
 #ifndef COMPANIES_Company_hpp
 #define COMPANIES_Company_hpp
 
+#include <cstddef>
 #include <iostream>
 #include <string>
 
+#include "Utilities/Binary.hpp"
 #include "Utilities/Exceptions.hpp"
+#include "Utilities/Hash.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/StringView.hpp"
 
 
 
@@ -62,14 +67,26 @@ namespace Companies
 
 
       // Queries
-      std::string name() const noexcept;
+      std::string            name     () const noexcept;
+      Utilities::StringView  nameView () const noexcept;   // valid until the company is modified or destroyed
+      std::size_t            hash     () const noexcept;   // consistent with operator==, kept until the company is modified
 
 
       // Conversions
       explicit operator std::string() const;
 
+      // The record operator<< writes (fields separated by FIELD_SEPARATOR, ended by RECORD_SEPARATOR), without a stream or any
+      // temporary strings.  formatTo() returns the record's length, and only writes the record if it fits in size characters.
+      void         appendTo ( std::string & record            ) const;
+      std::size_t  formatTo ( char * buffer, std::size_t size ) const noexcept;
 
-      // Modifiers
+
+      // Binary form (see Utilities/Binary.hpp).  deserialize() leaves the company unchanged if it throws.
+      void        serialize   ( Utilities::Binary::Buffer & buffer ) const;
+      Company &   deserialize ( Utilities::Binary::Reader & reader );
+
+
+      // Modifiers - strings are taken by value and moved into place, so an rvalue argument is never copied
       Company & name( std::string newName )  noexcept;
 
 
@@ -78,12 +95,12 @@ namespace Companies
     private:
       // Instance attribute (aka object state attributes)
       std::string                  _name;
+      Utilities::Hash::Cache       _hash;     // reset by every modifier
 
 
       // Class attributes
-      static constexpr char FIELD_SEPARATOR  = '\x03';  // ETX (End of Text) character
-      static constexpr char RECORD_SEPARATOR = '\x04';  // EOT (End of Transmission) character ('\n' turns out to not be a good choice because data
-                                                        //     files are not then portable between Windows, Unix, and Mac OSs.)
+      static constexpr char FIELD_SEPARATOR  = Utilities::Records::FIELD_SEPARATOR;   // ETX (End of Text) character
+      static constexpr char RECORD_SEPARATOR = Utilities::Records::RECORD_SEPARATOR;  // EOT (End of Transmission) character
   };  // class Company
 
 
@@ -103,5 +120,22 @@ namespace Companies
   std::istream & operator>> (std::istream & s,       Company & company);
   std::ostream & operator<< (std::ostream & s, const Company * company);
   std::istream & operator>> (std::istream & s,       Company * company);
+
+  // Builds company from the text of one record (without its RECORD_SEPARATOR), exactly as operator>> would after reading it from a
+  // stream.  Returns false, leaving company unchanged, if the record holds nothing to build from.
+  bool fromRecord( Utilities::StringView              record, Company & company );
+  bool fromRecord( const Utilities::Records::Fields & fields, Company & company );   // a record already split into fields
 } // namespace Companies
+
+
+
+
+namespace std
+{
+  template <>
+  struct hash<Companies::Company>
+  {
+    std::size_t operator()( const Companies::Company & company ) const noexcept  { return company.hash(); }
+  };
+} // namespace std
 #endif
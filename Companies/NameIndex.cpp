@@ -0,0 +1,373 @@
+/**
+ * File: NameIndex.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the NameIndex class.  The tree
+ *				is a bottom up segment tree:  leaves are nodes count through 2 count - 1,
+ *				node i covers nodes 2i and 2i + 1, and a range is answered by climbing
+ *				from both of its ends.
+ **/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+#include "Companies/NameIndex.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+namespace Companies {
+	namespace {
+		constexpr char          MAGIC[4]    = { 'M', 'S', 'N', 'X' };
+		constexpr std::uint8_t  VERSION     = 1;
+		constexpr std::uint8_t  FOLDED      = 1;   // flags bit:  case insensitive
+		constexpr std::size_t   HEADER_SIZE = 32;
+
+		char fold(char c) noexcept {
+			return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+		}
+
+		// compares as the folded names would, byte by byte and unsigned, the way StringView::compare() does
+		int compareFolded(Utilities::StringView lhs, Utilities::StringView rhs) noexcept {
+			const std::size_t length = std::min(lhs.size(), rhs.size());
+			for (std::size_t i = 0; i < length; ++i) {
+				const unsigned char l = static_cast<unsigned char>(fold(lhs[i]));
+				const unsigned char r = static_cast<unsigned char>(fold(rhs[i]));
+				if (l != r) {
+					return l < r ? -1 : 1;
+				}
+			}
+			return lhs.size() < rhs.size() ? -1 : lhs.size() > rhs.size() ? 1 : 0;
+		}
+
+		// the layout that follows the header, in bytes from the start of the image
+		struct Layout {
+			std::size_t offsets, counts, tree, names, keys, size;
+
+			Layout(std::size_t count, std::size_t nameBytes, bool folded) noexcept {
+				offsets = HEADER_SIZE;
+				counts  = offsets + (count + 1) * sizeof(std::uint32_t);
+				tree    = counts + count * sizeof(std::uint32_t);
+				names   = tree + 2 * count * sizeof(std::uint32_t);
+				keys    = folded ? names + nameBytes : names;
+				size    = names + (folded ? 2 : 1) * nameBytes;
+			}
+		};
+
+		// the first position in [first, last) where done(position) is true, done being false and then true
+		template <typename Predicate>
+		std::uint32_t partition(std::uint32_t first, std::uint32_t last, Predicate done) {
+			while (first < last) {
+				const std::uint32_t middle = first + (last - first) / 2;
+				if (done(middle)) {
+					last = middle;
+				}
+				else {
+					first = middle + 1;
+				}
+			}
+			return first;
+		}
+	}
+
+	/**********************
+	* Constructors
+	**********************/
+	NameIndex::NameIndex(const std::vector<Utilities::StringView> & names, bool caseInsensitive) {
+		// names in key order, then as written
+		std::vector<std::uint32_t> order(names.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::sort(order.begin(), order.end(), [&names, caseInsensitive](std::uint32_t lhs, std::uint32_t rhs) {
+			const int folded = caseInsensitive ? compareFolded(names[lhs], names[rhs]) : 0;
+			return folded != 0 ? folded < 0 : names[lhs] < names[rhs];
+		});
+		auto sameKey = [&names, caseInsensitive](std::uint32_t lhs, std::uint32_t rhs) {
+			return caseInsensitive ? compareFolded(names[lhs], names[rhs]) == 0 : names[lhs] == names[rhs];
+		};
+
+		// one entry per distinct key, counting every occurrence, written the way it occurs most often (first in order on a tie)
+		std::vector<std::uint32_t> distinct;
+		std::vector<std::uint32_t> counts;
+		std::size_t nameBytes = 0;
+		for (std::size_t first = 0; first < order.size(); ) {
+			std::uint32_t spelling = order[first];
+			std::size_t   most     = 0;
+			std::uint32_t total    = 0;
+			std::size_t   next     = first;
+			while (next < order.size() && sameKey(order[first], order[next])) {
+				std::size_t end = next;
+				while (end < order.size() && names[order[end]] == names[order[next]]) {
+					++end;
+				}
+				if (end - next > most) {
+					spelling = order[next];
+					most     = end - next;
+				}
+				total = static_cast<std::uint32_t>(std::min<std::size_t>(std::size_t{ total } + (end - next), UINT32_MAX));
+				next  = end;
+			}
+			distinct.push_back(spelling);
+			counts.push_back(total);
+			nameBytes += names[spelling].size();
+			first = next;
+		}
+		if (nameBytes > UINT32_MAX || distinct.size() > UINT32_MAX / 2) {
+			throw NameIndexExceptions("Too many company names for one index", __LINE__, __func__, __FILE__);
+		}
+
+		// the image, tree last since it needs the counts in place
+		const std::uint32_t count = static_cast<std::uint32_t>(distinct.size());
+		const Layout layout(count, nameBytes, caseInsensitive);
+		_built.assign(layout.size, 0);
+		char * image = _built.data();
+
+		const std::uint64_t bytes = nameBytes;
+		std::memcpy(image, MAGIC, sizeof(MAGIC));
+		image[4] = static_cast<char>(VERSION);
+		image[5] = static_cast<char>(caseInsensitive ? FOLDED : 0);
+		std::memcpy(image + 8, &count, 4);
+		std::memcpy(image + 16, &bytes, 8);
+
+		std::uint32_t * offsets = reinterpret_cast<std::uint32_t *>(image + layout.offsets);
+		std::uint32_t   offset  = 0;
+		for (std::uint32_t i = 0; i < count; ++i) {
+			const Utilities::StringView name = names[distinct[i]];
+			offsets[i] = offset;
+			std::copy(name.begin(), name.end(), image + layout.names + offset);
+			if (caseInsensitive) {
+				std::transform(name.begin(), name.end(), image + layout.keys + offset, fold);
+			}
+			offset += static_cast<std::uint32_t>(name.size());
+		}
+		offsets[count] = offset;
+		if (!counts.empty()) {
+			std::memcpy(image + layout.counts, counts.data(), counts.size() * sizeof(std::uint32_t));
+		}
+
+		attach(image, layout.size);
+
+		std::uint32_t * tree = reinterpret_cast<std::uint32_t *>(image + layout.tree);
+		for (std::uint32_t i = 0; i < count; ++i) {
+			tree[count + i] = i;
+		}
+		for (std::uint32_t i = count; i-- > 1; ) {
+			tree[i] = better(tree[2 * i], tree[2 * i + 1]) ? tree[2 * i] : tree[2 * i + 1];
+		}
+	}
+
+	NameIndex::NameIndex(NameIndex && other) noexcept
+		: _built(std::move(other._built)), _mapped(std::move(other._mapped)),
+		  _image(other._image), _imageSize(other._imageSize), _count(other._count), _folded(other._folded),
+		  _offsets(other._offsets), _counts(other._counts), _tree(other._tree), _names(other._names), _keys(other._keys) {
+		other.detach();
+	}
+
+	NameIndex & NameIndex::operator=(NameIndex && other) noexcept {
+		if (this != &other) {
+			_built     = std::move(other._built);
+			_mapped    = std::move(other._mapped);
+			_image     = other._image;
+			_imageSize = other._imageSize;
+			_count     = other._count;
+			_folded    = other._folded;
+			_offsets   = other._offsets;
+			_counts    = other._counts;
+			_tree      = other._tree;
+			_names     = other._names;
+			_keys      = other._keys;
+			other.detach();
+		}
+		return *this;
+	}
+
+	// the first field of each record is the company's name, as fromRecord() takes it
+	NameIndex NameIndex::fromFile(const std::string & path, bool caseInsensitive) {
+		const Utilities::MappedFile file(path);
+
+		std::vector<Utilities::StringView> names;
+		Utilities::Records::forEachRecord(file.contents(), [&names](Utilities::StringView, const Utilities::Records::Fields & fields) {
+			if (fields.count != 0) {
+				names.push_back(fields.field[0]);
+			}
+		});
+		return NameIndex(names, caseInsensitive);
+	}
+
+	NameIndex NameIndex::load(const std::string & path) {
+		NameIndex index;
+		index._mapped = Utilities::MappedFile(path);
+		try {
+			index.attach(index._mapped.data(), index._mapped.size());
+		}
+		catch (const NameIndexExceptions & ex) {
+			throw NameIndexExceptions("\"" + path + "\" " + ex.what(), __LINE__, __func__, __FILE__);
+		}
+		return index;
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	std::vector<NameIndex::Match> NameIndex::complete(Utilities::StringView prefix, std::size_t k) const {
+		std::vector<Match> matches;
+		const Range range = matching(prefix);
+		if (range.first == range.last || k == 0) {
+			return matches;
+		}
+
+		// the best of each range not yet taken from, best range first
+		struct Candidate { std::uint32_t position, first, last; };
+		auto worse = [this](const Candidate & lhs, const Candidate & rhs) { return better(rhs.position, lhs.position); };
+		std::priority_queue<Candidate, std::vector<Candidate>, decltype(worse)> candidates(worse);
+
+		candidates.push({ best(range.first, range.last), range.first, range.last });
+		while (!candidates.empty() && matches.size() < k) {
+			const Candidate next = candidates.top();
+			candidates.pop();
+			matches.push_back({ name(next.position), _counts[next.position] });
+
+			if (next.first < next.position) {
+				candidates.push({ best(next.first, next.position), next.first, next.position });
+			}
+			if (next.position + 1 < next.last) {
+				candidates.push({ best(next.position + 1, next.last), next.position + 1, next.last });
+			}
+		}
+		return matches;
+	}
+
+	std::size_t NameIndex::count(Utilities::StringView prefix) const {
+		const Range range = matching(prefix);
+		return range.last - range.first;
+	}
+
+	std::size_t NameIndex::size() const noexcept {
+		return _count;
+	}
+
+	std::size_t NameIndex::bytes() const noexcept {
+		return _imageSize;
+	}
+
+	bool NameIndex::caseInsensitive() const noexcept {
+		return _folded;
+	}
+
+	void NameIndex::save(const std::string & path) const {
+		if (_image == nullptr) {
+			NameIndex(std::vector<Utilities::StringView>()).save(path);
+			return;
+		}
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(_image, static_cast<std::streamsize>(_imageSize));
+		if (!file.flush()) {
+			throw NameIndexExceptions("Unable to write \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+	}
+
+
+	/**********************
+	* Helpers
+	**********************/
+	void NameIndex::attach(const char * image, std::size_t size) {
+		if (size < HEADER_SIZE || std::memcmp(image, MAGIC, sizeof(MAGIC)) != 0) {
+			throw NameIndexExceptions("is not a company name index image", __LINE__, __func__, __FILE__);
+		}
+		if (static_cast<std::uint8_t>(image[4]) != VERSION) {
+			throw NameIndexExceptions("is a different company name index image version", __LINE__, __func__, __FILE__);
+		}
+
+		std::uint32_t count;
+		std::uint64_t nameBytes;
+		std::memcpy(&count, image + 8, 4);
+		std::memcpy(&nameBytes, image + 16, 8);
+		const bool folded = (static_cast<std::uint8_t>(image[5]) & FOLDED) != 0;
+
+		const Layout layout(count, static_cast<std::size_t>(nameBytes), folded);
+		const std::uint32_t * offsets = reinterpret_cast<const std::uint32_t *>(image + layout.offsets);
+		if (nameBytes > UINT32_MAX || count > UINT32_MAX / 2 || layout.size != size || offsets[0] != 0 || offsets[count] != nameBytes) {
+			throw NameIndexExceptions("is truncated or corrupt", __LINE__, __func__, __FILE__);
+		}
+
+		// every name and tree node must lie within the image, or queries would read past it
+		const std::uint32_t * tree = reinterpret_cast<const std::uint32_t *>(image + layout.tree);
+		for (std::uint32_t i = 0; i < count; ++i) {
+			if (offsets[i] > offsets[i + 1] || tree[count + i] >= count || (i != 0 && tree[i] >= count)) {
+				throw NameIndexExceptions("is corrupt", __LINE__, __func__, __FILE__);
+			}
+		}
+
+		_image     = image;
+		_imageSize = size;
+		_count     = count;
+		_folded    = folded;
+		_offsets   = offsets;
+		_counts    = reinterpret_cast<const std::uint32_t *>(image + layout.counts);
+		_tree      = tree;
+		_names     = image + layout.names;
+		_keys      = image + layout.keys;
+	}
+
+	void NameIndex::detach() noexcept {
+		_image     = nullptr;
+		_imageSize = 0;
+		_count     = 0;
+		_folded    = false;
+		_offsets   = nullptr;
+		_counts    = nullptr;
+		_tree      = nullptr;
+		_names     = nullptr;
+		_keys      = nullptr;
+	}
+
+	// the keys starting with prefix:  those not less than it, up to the first greater than it in its first prefix.size() characters
+	NameIndex::Range NameIndex::matching(Utilities::StringView prefix) const {
+		std::string folded;
+		if (_folded) {
+			folded.resize(prefix.size());
+			std::transform(prefix.begin(), prefix.end(), folded.begin(), fold);
+			prefix = folded;
+		}
+
+		const std::uint32_t first = partition(0, _count, [this, prefix](std::uint32_t i) {
+			return key(i) >= prefix;
+		});
+		const std::uint32_t last = partition(first, _count, [this, prefix](std::uint32_t i) {
+			return key(i).compare(0, prefix.size(), prefix) > 0;
+		});
+		return { first, last };
+	}
+
+	std::uint32_t NameIndex::best(std::uint32_t first, std::uint32_t last) const noexcept {
+		std::uint32_t result = first;
+		for (first += _count, last += _count; first < last; first /= 2, last /= 2) {
+			if (first % 2 == 1) {
+				result = better(_tree[first], result) ? _tree[first] : result;
+				++first;
+			}
+			if (last % 2 == 1) {
+				--last;
+				result = better(_tree[last], result) ? _tree[last] : result;
+			}
+		}
+		return result;
+	}
+
+	// more occurrences first, then earlier in key order
+	bool NameIndex::better(std::uint32_t lhs, std::uint32_t rhs) const noexcept {
+		return _counts[lhs] != _counts[rhs] ? _counts[lhs] > _counts[rhs] : lhs < rhs;
+	}
+
+	Utilities::StringView NameIndex::name(std::uint32_t position) const noexcept {
+		return Utilities::StringView(_names + _offsets[position], _offsets[position + 1] - _offsets[position]);
+	}
+
+	Utilities::StringView NameIndex::key(std::uint32_t position) const noexcept {
+		return Utilities::StringView(_keys + _offsets[position], _offsets[position + 1] - _offsets[position]);
+	}
+}
@@ -0,0 +1,123 @@
+/**
+ * File: NameIndex.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the NameIndex class, a prefix search
+ *				(autocomplete) index of company names.  complete("acm", 10) returns the
+ *				10 best names starting with "acm":  the names that occur most often in
+ *				what the index was built from, then in alphabetical order.  A case
+ *				insensitive index compares names with ASCII letters folded to lower case.
+ *				Names differing only in case are one entry there, counting all their
+ *				occurrences, returned as the most common way of writing it.
+ *
+ *				The whole index is one flat image:  the distinct names sorted, their
+ *				occurrence counts, and a tree over the counts (each node holds the best
+ *				name below it).  The names starting with a prefix are one contiguous
+ *				range, found by binary search, and the tree gives the best of any range
+ *				in O(log n), so the top k come out of a small priority queue of ranges
+ *				without looking at the rest of the matches.
+ *
+ *				save() writes the image as is and load() memory maps it, so a loaded index
+ *				needs no rebuilding and its pages are shared by every process using it.
+ *				load() reads the offsets and tree once to check they stay in the image.
+ *				The image is a 32 byte header (magic "MSNX", version, flags, name count,
+ *				name bytes) followed by uint32 name offsets, counts and tree nodes, then
+ *				the names, then (case insensitive only) the folded names.  Numbers are in
+ *				the machine's byte order.
+ *
+ *				Usage:
+ *				        auto index = Companies::NameIndex::fromFile("companies.dat", true);
+ *				        index.save("companies.names");
+ *				        ...
+ *				        auto index = Companies::NameIndex::load("companies.names");
+ *				        for (const auto & match : index.complete("acm", 10))  std::cout << match.name << '\n';
+ **/
+
+#ifndef COMPANIES_NameIndex_hpp
+#define COMPANIES_NameIndex_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utilities/Exceptions.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Companies
+{
+  class NameIndex
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct NameIndexExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // too many names, or an image that can't be saved or loaded
+
+      struct Match
+      {
+        Utilities::StringView   name;    // points into the index, valid as long as it is
+        std::uint32_t           count;   // occurrences in what the index was built from
+      };
+
+
+      // Constructors and Destructor
+      NameIndex             (                    ) noexcept = default;
+      NameIndex             ( const NameIndex &  )          = delete;
+      NameIndex             (       NameIndex && ) noexcept;
+      NameIndex & operator= ( const NameIndex &  )          = delete;
+      NameIndex & operator= (       NameIndex && ) noexcept;
+     ~NameIndex             (                    ) noexcept = default;
+
+      explicit NameIndex( const std::vector<Utilities::StringView> & names, bool caseInsensitive = false );
+
+      // The company names in a file of Company records (as written by operator<<)
+      static NameIndex  fromFile ( const std::string & path, bool caseInsensitive = false );
+
+      // Maps an image written by save().  Throws MappedFile::MappedFileExceptions or NameIndexExceptions.
+      static NameIndex  load     ( const std::string & path );
+
+
+      // Queries
+      std::vector<Match>  complete        ( Utilities::StringView prefix, std::size_t k ) const;   // best first
+      std::size_t         count           ( Utilities::StringView prefix                ) const;   // distinct names with the prefix
+
+      std::size_t         size            () const noexcept;   // distinct names
+      std::size_t         bytes           () const noexcept;   // size of the image
+      bool                caseInsensitive () const noexcept;
+
+      void                save            ( const std::string & path ) const;
+
+
+
+
+    private:
+      struct Range { std::uint32_t first, last; };   // [first, last)
+
+      void                   attach    ( const char * image, std::size_t size );   // sets the views below, checking the layout
+      void                   detach    () noexcept;
+      Range                  matching  ( Utilities::StringView prefix ) const;
+      std::uint32_t          best      ( std::uint32_t first, std::uint32_t last ) const noexcept;   // position of the best in [first, last)
+      bool                   better    ( std::uint32_t lhs,   std::uint32_t rhs  ) const noexcept;
+      Utilities::StringView  name      ( std::uint32_t position ) const noexcept;
+      Utilities::StringView  key       ( std::uint32_t position ) const noexcept;   // folded name if case insensitive
+
+      // Instance attribute (aka object state attributes)
+      std::vector<char>        _built;             // the image of an index built in memory, or
+      Utilities::MappedFile    _mapped;            // the image of a loaded index
+
+      const char *             _image      = nullptr;
+      std::size_t              _imageSize  = 0;
+      std::uint32_t            _count      = 0;
+      bool                     _folded     = false;
+      const std::uint32_t *    _offsets    = nullptr;   // name i is _names[_offsets[i], _offsets[i + 1])
+      const std::uint32_t *    _counts     = nullptr;
+      const std::uint32_t *    _tree       = nullptr;   // node i's best is at position _tree[i], leaves at _count + position
+      const char *             _names      = nullptr;
+      const char *             _keys       = nullptr;   // _names, or the folded names
+  };  // class NameIndex
+} // namespace Companies
+#endif
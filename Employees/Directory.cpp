@@ -0,0 +1,330 @@
+/**
+ * File: Directory.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the Directory class.
+ *
+ *				The query's posting lists are read together in Id order, a window of Ids
+ *				at a time, so the counters of shared trigrams are one small array reused
+ *				for every window, cleared by the Ids that were counted rather than whole.
+ *
+ *				A name with Jaccard similarity s to a query shares at least s times as
+ *				many trigrams with it as the query has (the union is never smaller than the
+ *				query), so an employee is only scored once that many of the query's lists
+ *				have named them.  For the same reason no one sharing s trigrams scores more
+ *				than s over the query's trigrams, which ends the scoring early once the
+ *				best matches are found.
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+#include "Employees/Directory.hpp"
+#include "Utilities/Postings.hpp"
+
+namespace Employees {
+	namespace {
+		constexpr std::size_t COUNT_WINDOW = 64 * 1024;   // Ids counted at once, 128 KB of counters
+
+		char fold(char c) noexcept {
+			return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+		}
+
+		bool isSpace(char c) noexcept {
+			return c == ' ' || c == '\t';
+		}
+
+		std::uint32_t trigram(char a, char b, char c) noexcept {
+			return static_cast<std::uint32_t>(static_cast<unsigned char>(a)) << 16 |
+			       static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8  |
+			       static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+		}
+
+		// appends the trigrams of each word of text, folded and padded as "  word "
+		void appendTrigrams(Utilities::StringView text, std::vector<std::uint32_t> & trigrams) {
+			for (std::size_t i = 0; i < text.size(); ) {
+				if (isSpace(text[i])) {
+					++i;
+					continue;
+				}
+
+				// the last three characters, rolling in each one
+				std::uint32_t window = trigram('\0', ' ', ' ');
+				for (; i < text.size() && !isSpace(text[i]); ++i) {
+					window = (window << 8 | static_cast<unsigned char>(fold(text[i]))) & 0xFFFFFF;
+					trigrams.push_back(window);
+				}
+				trigrams.push_back((window << 8 | static_cast<unsigned char>(' ')) & 0xFFFFFF);
+			}
+		}
+
+		void sortUnique(std::vector<std::uint32_t> & values) {
+			std::sort(values.begin(), values.end());
+			values.erase(std::unique(values.begin(), values.end()), values.end());
+		}
+
+		// Jaccard index of two sorted sets
+		double similarity(const std::vector<std::uint32_t> & lhs, const std::vector<std::uint32_t> & rhs) noexcept {
+			std::size_t shared = 0;
+			for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end() && r != rhs.end(); ) {
+				if (*l < *r) {
+					++l;
+				}
+				else if (*r < *l) {
+					++r;
+				}
+				else {
+					++shared;
+					++l;
+					++r;
+				}
+			}
+			const std::size_t all = lhs.size() + rhs.size() - shared;
+			return all == 0 ? 0.0 : static_cast<double>(shared) / static_cast<double>(all);
+		}
+	}
+
+
+	/**********************
+	* Constructors
+	**********************/
+	Directory::Directory(const std::vector<Employee> & roster) {
+		if (roster.size() >= UINT32_MAX) {
+			throw DirectoryExceptions("Too many employees for one directory", __LINE__, __func__, __FILE__);
+		}
+
+		// every (trigram, employee) pair, employee in the low bits so sorting groups each trigram's list in Id order
+		std::vector<std::uint64_t>  entries;
+		std::vector<std::uint32_t>  trigrams;
+		_bounds.reserve(2 * roster.size() + 1);
+		for (std::size_t id = 0; id < roster.size(); ++id) {
+			const Utilities::StringView firstName = roster[id].firstNameView();
+			const Utilities::StringView lastName  = roster[id].lastNameView();
+
+			_bounds.push_back(static_cast<std::uint32_t>(_names.size()));
+			std::transform(firstName.begin(), firstName.end(), std::back_inserter(_names), fold);
+			_bounds.push_back(static_cast<std::uint32_t>(_names.size()));
+			std::transform(lastName.begin(), lastName.end(), std::back_inserter(_names), fold);
+			if (_names.size() > UINT32_MAX) {
+				throw DirectoryExceptions("Too many employee names for one directory", __LINE__, __func__, __FILE__);
+			}
+
+			trigrams.clear();
+			appendTrigrams(firstName, trigrams);
+			appendTrigrams(lastName, trigrams);
+			sortUnique(trigrams);
+			for (const std::uint32_t key : trigrams) {
+				entries.push_back(std::uint64_t{key} << 32 | id);
+			}
+		}
+		_bounds.push_back(static_cast<std::uint32_t>(_names.size()));
+		std::sort(entries.begin(), entries.end());
+
+		std::vector<EmployeeId> ids;
+		for (std::size_t i = 0; i < entries.size(); ) {
+			const std::uint32_t key = static_cast<std::uint32_t>(entries[i] >> 32);
+			ids.clear();
+			for (; i < entries.size() && static_cast<std::uint32_t>(entries[i] >> 32) == key; ++i) {
+				ids.push_back(static_cast<EmployeeId>(entries[i]));
+			}
+
+			if (_postings.size() > UINT32_MAX) {
+				throw DirectoryExceptions("Posting lists too large for one directory", __LINE__, __func__, __FILE__);
+			}
+			_trigrams.push_back({ key, static_cast<std::uint32_t>(_postings.size()), static_cast<std::uint32_t>(ids.size()) });
+			Utilities::Postings::encode(ids.data(), ids.size(), _postings);
+		}
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	std::vector<Directory::Match> Directory::search(Utilities::StringView query, std::size_t limit, double minimumSimilarity) const {
+		std::vector<Match> matches;
+
+		std::vector<std::uint32_t> wanted;
+		appendTrigrams(query, wanted);
+		sortUnique(wanted);
+		if (wanted.size() > UINT16_MAX) {
+			throw DirectoryExceptions("Query has too many trigrams to search for", __LINE__, __func__, __FILE__);
+		}
+		if (wanted.empty() || limit == 0) {
+			return matches;
+		}
+
+		// the employees on enough of the query's lists to reach the minimum similarity are candidates
+		const std::size_t needed = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(minimumSimilarity * wanted.size() - 1e-9)));
+		std::vector<Utilities::Postings::Cursor> lists;
+		for (const std::uint32_t key : wanted) {
+			if (const Trigram * found = find(key)) {
+				lists.emplace_back(_postings.data() + found->offset, found->count);
+			}
+		}
+
+		struct Candidate {
+			EmployeeId     id;
+			std::uint16_t  shared;   // query trigrams the employee has
+		};
+		std::vector<Candidate> candidates;
+
+		// count a window of Ids at a time, in counters that stay in cache, clearing only the ones used
+		std::vector<std::uint16_t> shared(std::min(size(), COUNT_WINDOW));
+		std::vector<EmployeeId>    counted;
+		for (;;) {
+			EmployeeId base = UINT32_MAX;
+			for (const auto & list : lists) {
+				if (!list.atEnd()) {
+					base = std::min(base, list.id());
+				}
+			}
+			if (base == UINT32_MAX) {
+				break;
+			}
+			base -= base % COUNT_WINDOW;
+			const std::size_t end = std::size_t{ base } + shared.size();
+
+			for (auto & list : lists) {
+				for (; !list.atEnd() && list.id() < end; list.next()) {
+					if (shared[list.id() - base]++ == 0) {
+						counted.push_back(list.id());
+					}
+				}
+			}
+			for (const EmployeeId id : counted) {
+				if (shared[id - base] >= needed) {
+					candidates.push_back({ id, shared[id - base] });
+				}
+				shared[id - base] = 0;
+			}
+			counted.clear();
+		}
+
+		// score the candidates with the most shared trigrams first.  A candidate sharing s can score at most s / wanted.size(), so
+		// once that is below the worst of limit matches already found, no one left can make the list.
+		std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate & lhs, const Candidate & rhs) { return lhs.shared > rhs.shared; });
+
+		auto better = [](const Match & lhs, const Match & rhs) {
+			return lhs.similarity != rhs.similarity ? lhs.similarity > rhs.similarity : lhs.id < rhs.id;
+		};
+		std::vector<Match> best;   // heap, worst of the best on top
+
+		std::vector<std::uint32_t> firstTrigrams;
+		std::vector<std::uint32_t> lastTrigrams;
+		std::vector<std::uint32_t> bothTrigrams;
+		for (const Candidate & candidate : candidates) {
+			const EmployeeId id    = candidate.id;
+			const double     bound = static_cast<double>(candidate.shared) / static_cast<double>(wanted.size());
+			if (best.size() == limit && bound < best.front().similarity) {
+				break;
+			}
+
+			// the best of the last name, the first name and the whole name
+			firstTrigrams.clear();
+			lastTrigrams.clear();
+			appendTrigrams(first(id), firstTrigrams);
+			appendTrigrams(last(id), lastTrigrams);
+			bothTrigrams = firstTrigrams;
+			bothTrigrams.insert(bothTrigrams.end(), lastTrigrams.begin(), lastTrigrams.end());
+			sortUnique(firstTrigrams);
+			sortUnique(lastTrigrams);
+			sortUnique(bothTrigrams);
+
+			const Match match{ id, std::max({ similarity(wanted, lastTrigrams), similarity(wanted, firstTrigrams), similarity(wanted, bothTrigrams) }) };
+			if (match.similarity < minimumSimilarity) {
+				continue;
+			}
+			if (best.size() < limit) {
+				best.push_back(match);
+				std::push_heap(best.begin(), best.end(), better);
+			}
+			else if (better(match, best.front())) {
+				std::pop_heap(best.begin(), best.end(), better);
+				best.back() = match;
+				std::push_heap(best.begin(), best.end(), better);
+			}
+		}
+
+		std::sort_heap(best.begin(), best.end(), better);
+		matches = std::move(best);
+		return matches;
+	}
+
+	std::vector<Directory::EmployeeId> Directory::containing(Utilities::StringView fragment) const {
+		std::string folded;
+		std::transform(fragment.begin(), fragment.end(), std::back_inserter(folded), fold);
+
+		// a name containing the fragment has every trigram inside each of the fragment's words (not the padded ones)
+		std::vector<const Trigram *> lists;
+		for (std::size_t i = 0; i + 3 <= folded.size(); ++i) {
+			if (isSpace(folded[i]) || isSpace(folded[i + 1]) || isSpace(folded[i + 2])) {
+				continue;
+			}
+			const Trigram * found = find(trigram(folded[i], folded[i + 1], folded[i + 2]));
+			if (found == nullptr) {
+				return {};
+			}
+			lists.push_back(found);
+		}
+
+		// intersect the lists, shortest first, or check everyone if the fragment has no trigrams
+		std::vector<EmployeeId> ids;
+		if (lists.empty()) {
+			ids.resize(size());
+			for (EmployeeId id = 0; id < ids.size(); ++id) {
+				ids[id] = id;
+			}
+		}
+		else {
+			std::sort(lists.begin(), lists.end(), [](const Trigram * lhs, const Trigram * rhs) { return lhs->count < rhs->count; });
+			postings(*lists.front(), ids);
+
+			std::vector<EmployeeId> next;
+			for (auto list = lists.begin() + 1; list != lists.end() && !ids.empty(); ++list) {
+				postings(**list, next);
+				ids.resize(Utilities::Postings::intersect(ids.data(), ids.size(), next.data(), next.size(), ids.data()));
+			}
+		}
+
+		const Utilities::StringView wanted(folded);
+		ids.erase(std::remove_if(ids.begin(), ids.end(), [this, wanted](EmployeeId id) {
+			return first(id).find(wanted) == Utilities::StringView::npos && last(id).find(wanted) == Utilities::StringView::npos;
+		}), ids.end());
+		return ids;
+	}
+
+	std::size_t Directory::size() const noexcept {
+		return _bounds.empty() ? 0 : _bounds.size() / 2;
+	}
+
+	std::size_t Directory::bytes() const noexcept {
+		return _postings.size();
+	}
+
+
+	/**********************
+	* Helpers
+	**********************/
+	const Directory::Trigram * Directory::find(std::uint32_t key) const noexcept {
+		const auto found = std::lower_bound(_trigrams.begin(), _trigrams.end(), key, [](const Trigram & trigram, std::uint32_t k) {
+			return trigram.key < k;
+		});
+		return found != _trigrams.end() && found->key == key ? &*found : nullptr;
+	}
+
+	void Directory::postings(const Trigram & trigram, std::vector<EmployeeId> & ids) const {
+		ids.resize(trigram.count);
+		Utilities::Postings::decode(_postings.data() + trigram.offset, trigram.count, ids.data());
+	}
+
+	Utilities::StringView Directory::first(EmployeeId id) const noexcept {
+		return Utilities::StringView(_names.data() + _bounds[2 * id], _bounds[2 * id + 1] - _bounds[2 * id]);
+	}
+
+	Utilities::StringView Directory::last(EmployeeId id) const noexcept {
+		return Utilities::StringView(_names.data() + _bounds[2 * id + 1], _bounds[2 * id + 2] - _bounds[2 * id + 1]);
+	}
+}
@@ -0,0 +1,109 @@
+/**
+ * File: Directory.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the Directory class, a fuzzy name search
+ *				index over a roster of employees.  search("Strostrup") finds "Bjarne
+ *				Stroustrup" without comparing the query to every name.
+ *
+ *				Names are compared by their trigrams:  each word of the first and last
+ *				name, with ASCII letters folded to lower case, is padded with two spaces in
+ *				front and one behind and cut into every 3 character piece ("  s", " st",
+ *				"str", ...).  A misspelled word still shares most of its trigrams with the
+ *				right one.  The similarity of a query to a name is the Jaccard index of
+ *				their trigram sets (shared trigrams over all trigrams), taking the best of
+ *				the last name, the first name and the whole name.
+ *
+ *				The index maps each trigram to the sorted list of employees having it,
+ *				stored compressed (see Utilities/Postings.hpp).  A search counts, for each
+ *				employee, the query trigrams it has, by reading only the query's lists.
+ *				Only employees with enough shared trigrams to reach the minimum similarity
+ *				are scored.  containing() intersects the lists instead.
+ *
+ *				The Directory keeps the folded names it needs for scoring, but not the
+ *				employees:  Ids are positions in the roster it was built from.
+ *
+ *				Usage:
+ *				        Employees::Directory directory(roster);
+ *				        for (const auto & match : directory.search("Strostrup", 5))  ...  roster[match.id]  ...
+ **/
+
+#ifndef EMPLOYEES_Directory_hpp
+#define EMPLOYEES_Directory_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Employees/Employee.hpp"
+#include "Utilities/Exceptions.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Employees
+{
+  class Directory
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct DirectoryExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // Class Directory exception base class
+
+      using EmployeeId = std::uint32_t;
+
+      struct Match
+      {
+        EmployeeId  id;
+        double      similarity;   // 0 to 1, 1 when the trigram sets are the same
+      };
+
+
+      // Constructors and Destructor
+      Directory             (                    )          = default;
+      Directory             ( const Directory &  )          = default;
+      Directory             (       Directory && )          = default;
+      Directory & operator= ( const Directory &  )          = default;
+      Directory & operator= (       Directory && )          = default;
+     ~Directory             (                    ) noexcept = default;
+
+      explicit Directory( const std::vector<Employee> & roster );
+
+
+      // Queries
+      // The employees whose name is at least minimumSimilarity similar to query, most similar first (then by Id), at most limit.
+      // Throws DirectoryExceptions for a query of more than 65535 distinct trigrams.
+      std::vector<Match>       search     ( Utilities::StringView query, std::size_t limit = 10, double minimumSimilarity = 0.3 ) const;
+
+      // The employees whose first or last name contains fragment, ignoring case, in Id order
+      std::vector<EmployeeId>  containing ( Utilities::StringView fragment ) const;
+
+      std::size_t              size       () const noexcept;   // employees
+      std::size_t              bytes      () const noexcept;   // size of the compressed posting lists
+
+
+
+
+    private:
+      struct Trigram
+      {
+        std::uint32_t  key;      // the three characters, first in the high bits
+        std::uint32_t  offset;   // of its posting list in _postings
+        std::uint32_t  count;    // employees in the list
+      };
+
+      const Trigram *        find     ( std::uint32_t key ) const noexcept;
+      void                   postings ( const Trigram & trigram, std::vector<EmployeeId> & ids ) const;
+      Utilities::StringView  first    ( EmployeeId id ) const noexcept;   // folded names
+      Utilities::StringView  last     ( EmployeeId id ) const noexcept;
+
+      // Instance attribute (aka object state attributes)
+      std::vector<Trigram>         _trigrams;    // sorted by key
+      std::vector<std::uint8_t>    _postings;
+      std::string                  _names;       // every employee's folded first name then last name
+      std::vector<std::uint32_t>   _bounds;      // employee i's first name is _names[_bounds[2i], _bounds[2i + 1]), last name to _bounds[2i + 2]
+  };  // class Directory
+} // namespace Employees
+#endif
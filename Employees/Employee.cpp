@@ -7,12 +7,13 @@
  *				An Employee consists of a last and (optional) first name.
  **/
 
+#include <cstddef>
 #include <string>
-#include <sstream>
-#include <regex>
+#include <utility>
 #include <iostream>
 
 #include "Employees/Employee.hpp"
+#include "Employees/Names.hpp"
 
 namespace Employees {
 	/**********************
@@ -23,8 +24,8 @@ namespace Employees {
 		this->name(name);
 	}
 	Employee::Employee(std::string firstName, std::string lastName) noexcept {
-		this->firstName(firstName);
-		this->lastName(lastName);
+		this->firstName(std::move(firstName));
+		this->lastName(std::move(lastName));
 	}
 
 
@@ -32,13 +33,10 @@ namespace Employees {
 	* Queries
 	**********************/
 	std::string Employee::name()        const {
-		std::ostringstream oss;
-		oss << this->firstName() <<
-			FIELD_SEPARATOR <<
-			this->lastName() << 
-			RECORD_SEPARATOR;
+		std::string record;
+		appendTo(record);
 
-		return oss.str();
+		return record;
 	}
 	std::string Employee::firstName()   const {
 		return _firstName;
@@ -46,15 +44,52 @@ namespace Employees {
 	std::string Employee::lastName()    const {
 		return _lastName;
 	}
+	Utilities::StringView Employee::firstNameView() const noexcept {
+		return _firstName;
+	}
+	Utilities::StringView Employee::lastNameView() const noexcept {
+		return _lastName;
+	}
+	std::size_t Employee::hash() const noexcept {
+		return static_cast<std::size_t>(_hash.get([this]() { return Utilities::Hash::string(_firstName, Utilities::Hash::string(_lastName)); }));
+	}
 
 
 	/**********************
 	* Conversions
 	**********************/
 	Employee::operator std::string() const {
-		std::ostringstream oss;
-		oss << *this;
-		return oss.str();
+		return name();
+	}
+	void Employee::appendTo(std::string & record) const {
+		Utilities::Records::append(record, { _firstName, _lastName });
+	}
+	std::size_t Employee::formatTo(char * buffer, std::size_t size) const noexcept {
+		return Utilities::Records::format(buffer, size, { _firstName, _lastName });
+	}
+
+
+	/**********************
+	* Binary serialization
+	**********************/
+	void Employee::serialize(Utilities::Binary::Buffer & buffer) const {
+		const std::size_t record = buffer.beginRecord(Utilities::Binary::RecordType::EMPLOYEE);
+		buffer.putString(_firstName)
+		      .putString(_lastName);
+		buffer.endRecord(record);
+	}
+
+	Employee & Employee::deserialize(Utilities::Binary::Reader & reader) {
+		// read both names before changing anything.  They were split when written, so they're stored as is.
+		Utilities::Binary::Reader payload    = reader.record(Utilities::Binary::RecordType::EMPLOYEE);
+		const Utilities::StringView first    = payload.getString();
+		const Utilities::StringView last     = payload.getString();
+
+		_firstName.assign(first.data(), first.size());
+		_lastName .assign(last.data(), last.size());
+		_hash.reset();
+
+		return *this;
 	}
 
 
@@ -63,50 +98,38 @@ namespace Employees {
 	**********************/
 	// last name [, first name]
 	Employee & Employee::name(const std::string & newName)  noexcept {
-		// find a delimiting comma
-		std::regex nameRegex("([[:space:]]*,[[:space:]]*)");
-		std::smatch match;
-
-		// try to match the string using supplied regex
-		if (std::regex_search(newName, match, nameRegex) ) {
-			// the match was successful, the names will be prefix and suffix
-			this->lastName(match.prefix());
-			this->firstName(match.suffix());			
-		}
-		// no comma provided, last name only
-		else {
-			this->lastName(newName);
-			this->firstName(""); // clear first name
-		}
+		// split at the delimiting comma, if there is one
+		const Names::Parts parts = Names::split(newName);
+
+		// the names will be the parts on either side of it; they contain no commas, so they're assigned directly
+		_lastName.assign(parts.last.data(), parts.last.size());
+		_firstName.assign(parts.first.data(), parts.first.size()); // no comma provided clears the first name
+		_hash.reset();
 
 		return *this;
 	}
 	Employee & Employee::firstName(std::string   newName)  noexcept {
-		// find a delimiting comma (just to make sure the name is properly formatted)
-		std::regex nameRegex("([[:space:]]*,[[:space:]]*)");
-
-		// try to match the string using supplied regex
-		if (std::regex_search(newName, nameRegex)) {
+		// look for a delimiting comma (just to make sure the name is properly formatted)
+		if (Names::hasComma(newName)) {
 			// call the name modifier instead
 			this->name(newName);
 		}
 		else {
-			_firstName = newName;
+			_firstName = std::move(newName);
+			_hash.reset();
 		}
 
 		return *this;
 	}
 	Employee & Employee::lastName(std::string   newName)  noexcept {
-		// find a delimiting comma (just to make sure the name is properly formatted)
-		std::regex nameRegex("([[:space:]]*,[[:space:]]*)");		
-
-		// try to match the string using supplied regex
-		if (std::regex_search(newName, nameRegex)) {
+		// look for a delimiting comma (just to make sure the name is properly formatted)
+		if (Names::hasComma(newName)) {
 			// call the name modifier instead
 			this->name(newName);
 		}
 		else {
-			_lastName = newName;
+			_lastName = std::move(newName);
+			_hash.reset();
 		}
 
 		return *this;
@@ -117,13 +140,15 @@ namespace Employees {
 	**********************/
 	// equal to
 	bool operator==(const Employee & lhs, const Employee & rhs) {
-		return lhs.lastName() == rhs.lastName() &&
-			lhs.firstName() == rhs.firstName();
+		return lhs.lastNameView() == rhs.lastNameView() &&
+			lhs.firstNameView() == rhs.firstNameView();
 	}
-	// less than
+	// less than - by last name, then first name
 	bool operator< (const Employee & lhs, const Employee & rhs) {
-		return lhs.lastName() < rhs.lastName() &&
-			lhs.firstName() < rhs.firstName();
+		if (const int last = lhs._lastName.compare(rhs._lastName)) {
+			return last < 0;
+		}
+		return lhs._firstName < rhs._firstName;
 	}
 	// not equal to
 	bool operator!=(const Employee & lhs, const Employee & rhs) {
@@ -131,18 +156,15 @@ namespace Employees {
 	}
 	// greater than
 	bool operator> (const Employee & lhs, const Employee & rhs) {
-		return lhs.lastName() > rhs.lastName() &&
-			lhs.firstName() > rhs.firstName();
+		return rhs < lhs;
 	}
 	// less than or equal
 	bool operator<=(const Employee & lhs, const Employee & rhs) {
-		return lhs.lastName() <= rhs.lastName() &&
-			lhs.firstName() <= rhs.firstName();
+		return !(rhs < lhs);
 	}
 	// greater than or equal
 	bool operator>=(const Employee & lhs, const Employee & rhs) {
-		return lhs.lastName() >= rhs.lastName() &&
-			lhs.firstName() >= rhs.firstName();
+		return !(lhs < rhs);
 	}
 
 	/**********************
@@ -150,9 +172,7 @@ namespace Employees {
 	**********************/
 	// reference stream operators
 	std::ostream & operator<< (std::ostream & s, const Employee & employee) {
-		s << employee.name();
-
-		return s;
+		return Utilities::Records::write(s, employee);
 	}
 	std::istream & operator>> (std::istream & s, Employee & employee) {
 		// record string
@@ -160,26 +180,32 @@ namespace Employees {
 
 		// try to get the record from the stream
 		if (std::getline(s, record, Employee::RECORD_SEPARATOR)) {
-			// convert to stringstream
-			std::stringstream ss(record);
-
-			std::string lastName;
-			std::string firstName;
-
-			// try to get first name first
-			if (std::getline(ss, firstName, Employee::FIELD_SEPARATOR)) {
-				// last name if separated by the field separator
-				if (std::getline(ss, lastName, Employee::FIELD_SEPARATOR)) {
-					employee = Employee(firstName, lastName);
-				}
-				// might be a comma separated name, try it out
-				else {
-					employee = Employee(firstName);
-				}
-			}
+			fromRecord(record, employee);
 		}
 		return s;
 	}
+	// record operator
+	bool fromRecord(Utilities::StringView record, Employee & employee) {
+		return fromRecord(Utilities::Records::split(record), employee);
+	}
+	bool fromRecord(const Utilities::Records::Fields & fields, Employee & employee) {
+		const Utilities::StringView & firstName = fields.field[0];
+		const Utilities::StringView & lastName  = fields.field[1];
+
+		// first name first
+		if (fields.count == 0) {
+			return false;
+		}
+		// last name if separated by the field separator
+		if (fields.count > 1) {
+			employee = Employee(std::string(firstName.data(), firstName.size()), std::string(lastName.data(), lastName.size()));
+		}
+		// might be a comma separated name, try it out
+		else {
+			employee = Employee(std::string(firstName.data(), firstName.size()));
+		}
+		return true;
+	}
 	// pointer stream operators
 	std::ostream & operator<< (std::ostream & s, const Employee * employee) {
 		if (employee != nullptr) {
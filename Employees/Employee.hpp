@@ -25,10 +25,15 @@
 #ifndef EMPLOYEES_Employee_hpp
 #define EMPLOYEES_Employee_hpp
 
+#include <cstddef>
 #include <iostream>
 #include <string>
 
+#include "Utilities/Binary.hpp"
 #include "Utilities/Exceptions.hpp"
+#include "Utilities/Hash.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/StringView.hpp"
 
 
 
@@ -67,12 +72,27 @@ namespace Employees
       std::string firstName()   const;
       std::string lastName()    const;
 
+      Utilities::StringView  firstNameView () const noexcept;   // views of the stored names, valid until the employee is modified
+      Utilities::StringView  lastNameView  () const noexcept;   // or destroyed
+
+      std::size_t  hash () const noexcept;   // consistent with operator==, kept until the employee is modified
+
 
       // Conversions
       explicit operator std::string() const;
 
+      // The record operator<< writes (fields separated by FIELD_SEPARATOR, ended by RECORD_SEPARATOR), without a stream or any
+      // temporary strings.  formatTo() returns the record's length, and only writes the record if it fits in size characters.
+      void         appendTo ( std::string & record            ) const;
+      std::size_t  formatTo ( char * buffer, std::size_t size ) const noexcept;
+
 
-      // Modifiers
+      // Binary form (see Utilities/Binary.hpp).  deserialize() leaves the employee unchanged if it throws.
+      void         serialize   ( Utilities::Binary::Buffer & buffer ) const;
+      Employee &   deserialize ( Utilities::Binary::Reader & reader );
+
+
+      // Modifiers - strings are taken by value and moved into place, so an rvalue argument is never copied
       Employee & name      ( const std::string & newName )  noexcept;    // last name [, first name]
       Employee & firstName (       std::string   newName )  noexcept;
       Employee & lastName  (       std::string   newName )  noexcept;
@@ -84,12 +104,12 @@ namespace Employees
       // Instance attribute (aka object state attributes)
       std::string   _firstName;
       std::string   _lastName;
+      Utilities::Hash::Cache   _hash;     // reset by every modifier
 
 
       // Class attributes
-      static constexpr char FIELD_SEPARATOR  = '\x03';  // ETX (End of Text) character
-      static constexpr char RECORD_SEPARATOR = '\x04';  // EOT (End of Transmission) character ('\n' turns out to not be a good choice because data
-                                                        //     files are not then portable between Windows, Unix, and Mac OSs.)
+      static constexpr char FIELD_SEPARATOR  = Utilities::Records::FIELD_SEPARATOR;   // ETX (End of Text) character
+      static constexpr char RECORD_SEPARATOR = Utilities::Records::RECORD_SEPARATOR;  // EOT (End of Transmission) character
   };  // class Employee
 
 
@@ -109,6 +129,23 @@ namespace Employees
   std::istream & operator>> (std::istream & s, Employee & employee);
   std::ostream & operator<< (std::ostream & s, const Employee * employee);
   std::istream & operator>> (std::istream & s,       Employee * employee);
+
+  // Builds employee from the text of one record (without its RECORD_SEPARATOR), exactly as operator>> would after reading it from a
+  // stream.  Returns false, leaving employee unchanged, if the record holds nothing to build from.
+  bool fromRecord( Utilities::StringView              record, Employee & employee );
+  bool fromRecord( const Utilities::Records::Fields & fields, Employee & employee );   // a record already split into fields
 } // namespace Employees
 
+
+
+
+namespace std
+{
+  template <>
+  struct hash<Employees::Employee>
+  {
+    std::size_t operator()( const Employees::Employee & employee ) const noexcept  { return employee.hash(); }
+  };
+} // namespace std
+
 #endif
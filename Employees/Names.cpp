@@ -0,0 +1,91 @@
+/**
+ * File: Names.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the "Last, First" name tokenizer.
+ *				It finds the same boundaries as searching for the regular expression
+ *				"[[:space:]]*,[[:space:]]*", without building one.
+ **/
+
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "Employees/Names.hpp"
+
+namespace Employees {
+	namespace Names {
+		namespace {
+			inline bool isSpace(char c) noexcept {
+				return std::isspace(static_cast<unsigned char>(c)) != 0;
+			}
+		}
+
+		/**********************
+		* Tokenizer
+		**********************/
+		Parts split(Utilities::StringView name) noexcept {
+			const char * text = name.data();
+
+			// the last comma, and the one before it if any
+			std::size_t lastComma = name.size();
+			std::size_t previousComma = name.size();
+			for (std::size_t i = name.size(); i-- > 0; ) {
+				if (text[i] == ',') {
+					if (lastComma == name.size()) {
+						lastComma = i;
+					}
+					else {
+						previousComma = i;
+						break;
+					}
+				}
+			}
+
+			// no comma, last name only
+			if (lastComma == name.size()) {
+				return { name, Utilities::StringView(), false };
+			}
+
+			// the first name follows the last comma and the whitespace after it
+			std::size_t firstBegin = lastComma + 1;
+			while (firstBegin < name.size() && isSpace(text[firstBegin])) {
+				++firstBegin;
+			}
+
+			// the last name ends at the whitespace before the last comma, and starts after the previous comma and its whitespace
+			std::size_t lastBegin = 0;
+			if (previousComma != name.size()) {
+				lastBegin = previousComma + 1;
+				while (lastBegin < lastComma && isSpace(text[lastBegin])) {
+					++lastBegin;
+				}
+			}
+			std::size_t lastEnd = lastComma;
+			while (lastEnd > lastBegin && isSpace(text[lastEnd - 1])) {
+				--lastEnd;
+			}
+
+			return { name.substr(lastBegin, lastEnd - lastBegin), name.substr(firstBegin), true };
+		}
+
+		bool hasComma(Utilities::StringView name) noexcept {
+			return !name.empty() && std::memchr(name.data(), ',', name.size()) != nullptr;
+		}
+
+
+		/**********************
+		* Batch normalization
+		**********************/
+		void normalize(const std::vector<Utilities::StringView> & names, std::vector<Employee> & employees) {
+			employees.reserve(employees.size() + names.size());
+			for (const auto & name : names) {
+				const Parts parts = split(name);
+				employees.emplace_back(std::string(parts.first.data(), parts.first.size()),
+				                       std::string(parts.last.data(), parts.last.size()));
+			}
+		}
+	}
+}
@@ -0,0 +1,49 @@
+/**
+ * File: Names.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the "Last, First" name tokenizer used by
+ *				the Employee name modifiers, and a batch form of it for feed imports.
+ *
+ *				A comma and the whitespace around it separate the names.  When a name has
+ *				more than one comma, the last name is the part between the last two commas
+ *				and the first name is the part after the last one (the Employee modifiers
+ *				have always worked that way, e.g. "A, B, C" is last name "B", first name
+ *				"C").  Whitespace that isn't next to a comma is kept.
+ **/
+
+#ifndef EMPLOYEES_Names_hpp
+#define EMPLOYEES_Names_hpp
+
+#include <vector>
+
+#include "Employees/Employee.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Employees
+{
+  namespace Names
+  {
+    struct Parts
+    {
+      Utilities::StringView   last;
+      Utilities::StringView   first;
+      bool                    hasComma;    // false means the whole name is the last name and there is no first name
+    };
+
+
+    // Splits name in one pass from the end, without copying.  The parts are views into name.
+    Parts split( Utilities::StringView name ) noexcept;
+
+    bool  hasComma( Utilities::StringView name ) noexcept;
+
+
+    // Batch form of Employee::name():  splits every "Last, First" name of names and appends the employees, in order.
+    void  normalize( const std::vector<Utilities::StringView> & names, std::vector<Employee> & employees );
+  } // namespace Names
+} // namespace Employees
+#endif
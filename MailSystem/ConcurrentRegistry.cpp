@@ -0,0 +1,63 @@
+/**
+ * File: ConcurrentRegistry.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the ConcurrentRegistry class.
+ **/
+
+#include <utility>
+
+#include "MailSystem/ConcurrentRegistry.hpp"
+
+namespace MailSystem {
+	/**********************
+	* Constructors
+	**********************/
+	ConcurrentRegistry::ConcurrentRegistry(Registry initial)
+		: _current(std::make_shared<const Registry>(std::move(initial))) {
+	}
+
+	ConcurrentRegistry::Reader::Reader(const ConcurrentRegistry & source) noexcept
+		: _source(&source), _version(source.version()) {
+		// loaded after the version number, so the snapshot is at least that new
+		_snapshot = source.snapshot();
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	// may wait on the library's lock for this pointer while a writer stores it
+	ConcurrentRegistry::Snapshot ConcurrentRegistry::snapshot() const noexcept {
+		return std::atomic_load(&_current);
+	}
+
+	std::uint64_t ConcurrentRegistry::version() const noexcept {
+		return _version.load(std::memory_order_acquire);
+	}
+
+	// lock free until a new version is published, then one snapshot()
+	const Registry & ConcurrentRegistry::Reader::current() noexcept {
+		const std::uint64_t latest = _source->version();
+		if (latest != _version) {
+			_snapshot = _source->snapshot();
+			_version  = latest;
+		}
+		return *_snapshot;
+	}
+
+	const ConcurrentRegistry::Snapshot & ConcurrentRegistry::Reader::hold() const noexcept {
+		return _snapshot;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	// called with _writer held.  The store takes the same library lock as snapshot(), only for the pointer swap.
+	std::uint64_t ConcurrentRegistry::publish(Snapshot next) noexcept {
+		std::atomic_store(&_current, std::move(next));
+		return _version.fetch_add(1, std::memory_order_release) + 1;
+	}
+}
@@ -0,0 +1,133 @@
+/**
+ * File: ConcurrentRegistry.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the ConcurrentRegistry class, a Registry
+ *				shared by many reader threads and updated by writers.
+ *
+ *				Readers work on snapshots:  reference counted, immutable versions of the
+ *				registry.  A snapshot never changes, so any number of threads may query
+ *				it with no locking, and everything read from one snapshot is consistent
+ *				(an employee listed by employeesOf(c) has employerOf() == c).  A snapshot
+ *				stays alive as long as someone holds it, however many versions have been
+ *				published since.
+ *
+ *				Writers are copy-on-write:  update() copies the current version, applies
+ *				a batch of changes to the copy and publishes it with one atomic pointer
+ *				store.  Readers never wait for a writer to finish a batch, but each batch
+ *				costs a copy of the registry, so writers should group their changes.
+ *				Writers are serialized with each other.  If a batch throws, nothing is
+ *				published.
+ *
+ *				Taking a snapshot is one atomic shared_ptr load and a reference count
+ *				increment.  That load is not lock free:  libstdc++ and most other
+ *				libraries guard it with a mutex from a small shared pool, taken by the
+ *				writer's store too, so snapshot() can block for as long as a publish
+ *				takes to copy a pointer (never for a whole batch).  A Reader is the lock
+ *				free path for threads that read continually:  it keeps its snapshot and
+ *				only reloads when the version number has changed, so between updates a
+ *				read costs one atomic load of a counter that is rarely written.
+ *
+ *				Usage:
+ *				        MailSystem::ConcurrentRegistry shared(std::move(registry));
+ *
+ *				        // reader threads
+ *				        MailSystem::ConcurrentRegistry::Reader reader(shared);
+ *				        const auto & staff = reader.current().employeesOf(acme);
+ *
+ *				        // a writer thread
+ *				        shared.update([&](MailSystem::Registry & registry) {
+ *				            for (const auto & move : pending)  registry.transfer(move.employee, move.company);
+ *				        });
+ **/
+
+#ifndef MAILSYSTEM_ConcurrentRegistry_hpp
+#define MAILSYSTEM_ConcurrentRegistry_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "MailSystem/Registry.hpp"
+
+
+
+
+namespace MailSystem
+{
+  class ConcurrentRegistry
+  {
+    public:
+      using Snapshot = std::shared_ptr<const Registry>;
+
+      class Reader;
+
+
+      // Constructors and Destructor
+      ConcurrentRegistry             ( const ConcurrentRegistry &  ) = delete;
+      ConcurrentRegistry & operator= ( const ConcurrentRegistry &  ) = delete;
+
+      explicit ConcurrentRegistry( Registry initial = Registry() );
+
+
+      // Queries - safe from any thread
+      Snapshot        snapshot () const noexcept;   // the latest published version
+      std::uint64_t   version  () const noexcept;   // counts publications, starting at 0
+
+
+      // Modifiers - safe from any thread.  Applies changes(Registry &) to a copy of the latest version and publishes it.  Returns
+      // the new version number.
+      template <typename Changes>
+      std::uint64_t   update   ( Changes changes );
+
+
+
+
+    private:
+      std::uint64_t   publish  ( Snapshot next ) noexcept;
+
+      // Instance attribute (aka object state attributes)
+      Snapshot                     _current;        // accessed only through std::atomic_load and std::atomic_store
+      std::atomic<std::uint64_t>   _version { 0 };  // published after _current, so a reader that sees it changed finds the new version
+      std::mutex                   _writer;         // held for a whole batch
+  };  // class ConcurrentRegistry
+
+
+
+
+  // One thread's view of a ConcurrentRegistry.  Not shared between threads.
+  class ConcurrentRegistry::Reader
+  {
+    public:
+      explicit Reader( const ConcurrentRegistry & source ) noexcept;
+
+      // The latest version, reloaded only if a new one has been published.  The reference stays valid until the next call to
+      // current() on this Reader.
+      const Registry &  current () noexcept;
+
+      // The snapshot current() last returned, to keep it past the next call
+      const Snapshot &  hold    () const noexcept;
+
+    private:
+      const ConcurrentRegistry *   _source;
+      Snapshot                     _snapshot;
+      std::uint64_t                _version;
+  };  // class ConcurrentRegistry::Reader
+
+
+
+
+  // Template definitions
+  template <typename Changes>
+  std::uint64_t ConcurrentRegistry::update( Changes changes )
+  {
+    std::lock_guard<std::mutex> lock( _writer );
+
+    auto next = std::make_shared<Registry>( *std::atomic_load( &_current ) );
+    changes( *next );
+    return publish( std::move( next ) );
+  }
+} // namespace MailSystem
+#endif
@@ -0,0 +1,276 @@
+/**
+ * File: Registry.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the Registry class.
+ **/
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "MailSystem/Registry.hpp"
+
+namespace MailSystem {
+	namespace {
+		const std::vector<std::uint32_t> NO_IDS;
+
+		template <typename Pool, typename Index>
+		std::uint32_t findIn(const Pool & pool, const Index & index, const typename Pool::value_type & record) noexcept {
+			const auto matches = index.equal_range(record.hash());
+			for (auto match = matches.first; match != matches.second; ++match) {
+				if (pool[match->second] == record) {
+					return match->second;
+				}
+			}
+			return Registry::NONE;
+		}
+
+		// undoes the push_back of id onto ids, if it was made
+		template <typename Id>
+		void unpush(std::vector<Id> & ids, Id id) noexcept {
+			if (!ids.empty() && ids.back() == id) {
+				ids.pop_back();
+			}
+		}
+
+		template <typename Id>
+		void unpush(std::unordered_map<Id, std::vector<std::uint32_t>> & links, Id key, std::uint32_t id) noexcept {
+			const auto found = links.find(key);
+			if (found != links.end()) {
+				unpush(found->second, id);
+			}
+		}
+
+		template <typename Id>
+		const std::vector<std::uint32_t> & linksOf(const std::unordered_map<Id, std::vector<std::uint32_t>> & links, Id id) noexcept {
+			const auto found = links.find(id);
+			return found == links.end() ? NO_IDS : found->second;
+		}
+	}
+
+	constexpr std::uint32_t Registry::NONE;
+
+
+	/**********************
+	* Queries
+	**********************/
+	const Addresses::Address & Registry::address(AddressId id) const {
+		checkAddress(id, __func__);
+		return _addresses[id];
+	}
+	const Companies::Company & Registry::company(CompanyId id) const {
+		checkCompany(id, __func__);
+		return _companies[id];
+	}
+	const Employees::Employee & Registry::employee(EmployeeId id) const {
+		checkEmployee(id, __func__);
+		return _employees[id];
+	}
+
+	Registry::AddressId Registry::headquartersOf(CompanyId id) const {
+		checkCompany(id, __func__);
+		return _headquarters[id];
+	}
+	Registry::CompanyId Registry::employerOf(EmployeeId id) const {
+		checkEmployee(id, __func__);
+		return _employers[id];
+	}
+
+	std::size_t Registry::addressCount() const noexcept {
+		return _addresses.size();
+	}
+	std::size_t Registry::companyCount() const noexcept {
+		return _companies.size();
+	}
+	std::size_t Registry::employeeCount() const noexcept {
+		return _employees.size();
+	}
+
+	Registry::AddressId Registry::find(const Addresses::Address & address) const noexcept {
+		return findIn(_addresses, _addressIds, address);
+	}
+	Registry::CompanyId Registry::find(const Companies::Company & company) const noexcept {
+		return findIn(_companies, _companyIds, company);
+	}
+
+
+	/**********************
+	* Joins
+	**********************/
+	const std::vector<Registry::CompanyId> & Registry::companiesAt(AddressId id) const {
+		checkAddress(id, __func__);
+		return linksOf(_companiesAt, id);
+	}
+	const std::vector<Registry::EmployeeId> & Registry::employeesOf(CompanyId id) const {
+		checkCompany(id, __func__);
+		return linksOf(_employeesOf, id);
+	}
+	const std::vector<Registry::AddressId> & Registry::addressesIn(Addresses::States::Ordinal state) const noexcept {
+		return state <= Addresses::States::COUNT ? _addressesIn[state] : NO_IDS;
+	}
+
+	std::vector<Registry::CompanyId> Registry::companiesHeadquarteredIn(Addresses::States::Ordinal state) const {
+		std::vector<CompanyId> result;
+		for (const AddressId address : addressesIn(state)) {
+			const auto & companies = linksOf(_companiesAt, address);
+			result.insert(result.end(), companies.begin(), companies.end());
+		}
+		return result;
+	}
+	std::vector<Registry::EmployeeId> Registry::employeesHeadquarteredIn(Addresses::States::Ordinal state) const {
+		std::vector<EmployeeId> result;
+		for (const AddressId address : addressesIn(state)) {
+			for (const CompanyId company : linksOf(_companiesAt, address)) {
+				const auto & employees = linksOf(_employeesOf, company);
+				result.insert(result.end(), employees.begin(), employees.end());
+			}
+		}
+		return result;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	Registry::AddressId Registry::add(Addresses::Address address) {
+		const AddressId existing = find(address);
+		if (existing != NONE) {
+			return existing;
+		}
+
+		// the index last, so a failure part way leaves it nothing to point at
+		const AddressId          id    = static_cast<AddressId>(_addresses.size());
+		const std::size_t        hash  = address.hash();
+		std::vector<AddressId> & state = _addressesIn[address.stateOrdinal()];
+		try {
+			_addresses.push_back(std::move(address));
+			state.push_back(id);
+			_addressIds.emplace(hash, id);
+		}
+		catch (...) {
+			unpush(state, id);
+			if (_addresses.size() > id) {
+				_addresses.pop_back();
+			}
+			throw;
+		}
+		return id;
+	}
+
+	Registry::CompanyId Registry::add(Companies::Company company, AddressId headquarters) {
+		checkAddress(headquarters, __func__);
+		if (find(company) != NONE) {
+			throw DuplicateCompanyException("Company \"" + company.name() + "\" is already registered", __LINE__, __func__, __FILE__);
+		}
+
+		const CompanyId   id   = static_cast<CompanyId>(_companies.size());
+		const std::size_t hash = company.hash();
+		try {
+			_companies.push_back(std::move(company));
+			_headquarters.push_back(headquarters);
+			_companiesAt[headquarters].push_back(id);
+			_companyIds.emplace(hash, id);
+		}
+		catch (...) {
+			unpush(_companiesAt, headquarters, id);
+			if (_headquarters.size() > id) {
+				_headquarters.pop_back();
+			}
+			if (_companies.size() > id) {
+				_companies.pop_back();
+			}
+			throw;
+		}
+		return id;
+	}
+
+	Registry::EmployeeId Registry::add(Employees::Employee employee, CompanyId employer) {
+		checkCompany(employer, __func__);
+
+		const EmployeeId id = static_cast<EmployeeId>(_employees.size());
+		try {
+			_employees.push_back(std::move(employee));
+			_employers.push_back(employer);
+			_employeesOf[employer].push_back(id);
+		}
+		catch (...) {
+			unpush(_employeesOf, employer, id);
+			if (_employers.size() > id) {
+				_employers.pop_back();
+			}
+			if (_employees.size() > id) {
+				_employees.pop_back();
+			}
+			throw;
+		}
+		return id;
+	}
+
+	void Registry::relocate(CompanyId company, AddressId headquarters) {
+		checkCompany(company, __func__);
+		checkAddress(headquarters, __func__);
+
+		AddressId & current = _headquarters[company];
+		if (current != headquarters) {
+			auto & companies = _companiesAt[headquarters];
+			companies.insert(std::lower_bound(companies.begin(), companies.end(), company), company);
+			unlink(_companiesAt[current], company);   // after the insert, which may throw
+			current = headquarters;
+		}
+	}
+
+	void Registry::transfer(EmployeeId employee, CompanyId employer) {
+		checkEmployee(employee, __func__);
+		checkCompany(employer, __func__);
+
+		CompanyId & current = _employers[employee];
+		if (current != employer) {
+			auto & employees = _employeesOf[employer];
+			employees.insert(std::lower_bound(employees.begin(), employees.end(), employee), employee);
+			unlink(_employeesOf[current], employee);   // after the insert, which may throw
+			current = employer;
+		}
+	}
+
+	void Registry::reserve(std::size_t addresses, std::size_t companies, std::size_t employees) {
+		_addresses.reserve(addresses);
+		_addressIds.reserve(addresses);
+		_companies.reserve(companies);
+		_companyIds.reserve(companies);
+		_headquarters.reserve(companies);
+		_employees.reserve(employees);
+		_employers.reserve(employees);
+	}
+
+
+	/**********************
+	* Helpers
+	**********************/
+	// removes id from a sorted list of Ids
+	template <typename Id>
+	void Registry::unlink(std::vector<Id> & ids, Id id) noexcept {
+		const auto found = std::lower_bound(ids.begin(), ids.end(), id);
+		if (found != ids.end() && *found == id) {
+			ids.erase(found);
+		}
+	}
+
+	void Registry::checkAddress(AddressId id, const char * functionName) const {
+		if (id >= _addresses.size()) {
+			throw UnknownIdException("No address has Id " + std::to_string(id), __LINE__, functionName, __FILE__);
+		}
+	}
+	void Registry::checkCompany(CompanyId id, const char * functionName) const {
+		if (id >= _companies.size()) {
+			throw UnknownIdException("No company has Id " + std::to_string(id), __LINE__, functionName, __FILE__);
+		}
+	}
+	void Registry::checkEmployee(EmployeeId id, const char * functionName) const {
+		if (id >= _employees.size()) {
+			throw UnknownIdException("No employee has Id " + std::to_string(id), __LINE__, functionName, __FILE__);
+		}
+	}
+}
@@ -0,0 +1,138 @@
+/**
+ * File: Registry.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the Registry class, which owns the
+ *				addresses, companies and employees of the mail system and the links
+ *				between them:  each company has a headquarters address and each employee
+ *				works for a company.
+ *
+ *				Records are kept in dense pools and identified by their position, so
+ *				lookup by Id is an array index.  The forward links (company to
+ *				headquarters, employee to employer) are arrays indexed by Id as well.  The
+ *				reverse links (address to the companies headquartered there, company to its
+ *				employees) are hash indexes, since most addresses have no company.  With a
+ *				per state list of addresses on top, a join like "all employees of companies
+ *				headquartered in Ohio" only visits the records in its answer.
+ *
+ *				Addresses are interned:  adding an address equal (operator==) to one
+ *				already registered returns the existing Id.  Company names are unique.
+ *				Records are never removed, so Ids stay valid for the registry's lifetime.
+ *
+ *				Usage:
+ *				        MailSystem::Registry registry;
+ *				        auto hq   = registry.add(Addresses::Address("1 Main Street", "Columbus", "OH", "43215"));
+ *				        auto acme = registry.add(Companies::Company("Acme"), hq);
+ *				        registry.add(Employees::Employee("Doe, Jane"), acme);
+ *				        for (auto id : registry.employeesHeadquarteredIn(Addresses::States::fromCode("OH", 2)))  ...
+ **/
+
+#ifndef MAILSYSTEM_Registry_hpp
+#define MAILSYSTEM_Registry_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/States.hpp"
+#include "Companies/Company.hpp"
+#include "Employees/Employee.hpp"
+#include "Utilities/Exceptions.hpp"
+
+
+
+
+namespace MailSystem
+{
+  class Registry
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct RegistryExceptions          : Utilities::AbstractException<> { using AbstractException::AbstractException;   };  // Class Registry exception base class
+      struct   UnknownIdException        : RegistryExceptions             { using RegistryExceptions::RegistryExceptions; };  // no record has the Id
+      struct   DuplicateCompanyException : RegistryExceptions             { using RegistryExceptions::RegistryExceptions; };  // a company with the name is registered
+
+      using AddressId  = std::uint32_t;     // Ids are assigned consecutively from 0 in each pool
+      using CompanyId  = std::uint32_t;
+      using EmployeeId = std::uint32_t;
+
+      static constexpr std::uint32_t NONE = UINT32_MAX;   // returned by find() when there is no such record
+
+
+      // Constructors and Destructor
+      Registry             (                   )          = default;
+      Registry             ( const Registry &  )          = default;
+      Registry             (       Registry && )          = default;
+      Registry & operator= ( const Registry &  )          = default;
+      Registry & operator= (       Registry && )          = default;
+     ~Registry             (                   ) noexcept = default;
+
+
+      // Queries - O(1).  Ids must have been returned by add(), or UnknownIdException is thrown.
+      const Addresses::Address &     address        ( AddressId  id ) const;
+      const Companies::Company &     company        ( CompanyId  id ) const;
+      const Employees::Employee &    employee       ( EmployeeId id ) const;
+
+      AddressId                      headquartersOf ( CompanyId  id ) const;
+      CompanyId                      employerOf     ( EmployeeId id ) const;
+
+      std::size_t                    addressCount   () const noexcept;
+      std::size_t                    companyCount   () const noexcept;
+      std::size_t                    employeeCount  () const noexcept;
+
+      // Lookup by value through the hash indexes, NONE if not registered
+      AddressId                      find           ( const Addresses::Address & address ) const noexcept;
+      CompanyId                      find           ( const Companies::Company & company ) const noexcept;
+
+
+      // Joins - index lookups, in Id order within each address and company
+      const std::vector<CompanyId> &   companiesAt              ( AddressId id ) const;   // headquartered at the address
+      const std::vector<EmployeeId> &  employeesOf              ( CompanyId id ) const;
+      const std::vector<AddressId> &   addressesIn              ( Addresses::States::Ordinal state ) const noexcept;
+
+      std::vector<CompanyId>           companiesHeadquarteredIn ( Addresses::States::Ordinal state ) const;
+      std::vector<EmployeeId>          employeesHeadquarteredIn ( Addresses::States::Ordinal state ) const;
+
+
+      // Modifiers
+      AddressId    add            ( Addresses::Address  address );                          // the Id of an equal address if there is one
+      CompanyId    add            ( Companies::Company  company,  AddressId headquarters ); // throws DuplicateCompanyException
+      EmployeeId   add            ( Employees::Employee employee, CompanyId employer     );
+
+      void         relocate       ( CompanyId  company,  AddressId headquarters );          // moves a company's headquarters
+      void         transfer       ( EmployeeId employee, CompanyId employer     );          // moves an employee to another company
+
+      void         reserve        ( std::size_t addresses, std::size_t companies, std::size_t employees );
+
+
+
+
+    private:
+      template <typename Id>  static void  unlink ( std::vector<Id> & ids, Id id ) noexcept;
+
+      void  checkAddress  ( AddressId  id, const char * functionName ) const;
+      void  checkCompany  ( CompanyId  id, const char * functionName ) const;
+      void  checkEmployee ( EmployeeId id, const char * functionName ) const;
+
+      // Instance attribute (aka object state attributes)
+      std::vector<Addresses::Address>      _addresses;        // pools, indexed by Id
+      std::vector<Companies::Company>      _companies;
+      std::vector<Employees::Employee>     _employees;
+
+      std::vector<AddressId>               _headquarters;     // forward links, indexed by CompanyId and EmployeeId
+      std::vector<CompanyId>               _employers;
+
+      std::unordered_map<AddressId, std::vector<CompanyId>>    _companiesAt;   // reverse links, only for linked records
+      std::unordered_map<CompanyId, std::vector<EmployeeId>>   _employeesOf;
+
+      std::unordered_multimap<std::size_t, AddressId>          _addressIds;    // value indexes, by hash, holding Ids rather than
+      std::unordered_multimap<std::size_t, CompanyId>          _companyIds;    // copies of the records
+
+      std::array<std::vector<AddressId>, Addresses::States::COUNT + 1>   _addressesIn;   // indexed by state ordinal
+  };  // class Registry
+} // namespace MailSystem
+#endif
@@ -0,0 +1,78 @@
+/**
+ * File: CompanyNames.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Builds a company name autocomplete image from a file of Company records,
+ *				or completes a prefix against one.  See Companies/NameIndex.hpp.
+ *
+ * Usage:  CompanyNames build companies image [--ignore-case]
+ *         CompanyNames complete image prefix [count]     (default count 10)
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "Companies/NameIndex.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  void build( const std::string & companies, const std::string & image, bool ignoreCase )
+  {
+    const auto start = std::chrono::steady_clock::now();
+    const Companies::NameIndex index = Companies::NameIndex::fromFile( companies, ignoreCase );
+    index.save( image );
+    const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "Distinct names:  " << index.size() << '\n'
+              << "Image size:      " << index.bytes() << " bytes\n"
+              << "Case:            " << ( index.caseInsensitive() ? "ignored" : "significant" ) << '\n'
+              << "Time:            " << seconds << " s\n";
+  }
+
+
+  void complete( const std::string & image, const std::string & prefix, std::size_t count )
+  {
+    const Companies::NameIndex index = Companies::NameIndex::load( image );
+
+    const auto start   = std::chrono::steady_clock::now();
+    const auto matches = index.complete( prefix, count );
+    const double microseconds = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now() - start ).count();
+
+    for( const auto & match : matches )  std::cout << match.name << "  (" << match.count << ")\n";
+    std::cout << "\n" << matches.size() << " of " << index.count( prefix ) << " names in " << microseconds << " us\n";
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const bool building   = ( argc == 4  ||  ( argc == 5  &&  std::strcmp( argv[4], "--ignore-case" ) == 0 ) )  &&  std::strcmp( argv[1], "build" ) == 0;
+  const bool completing = ( argc == 4  ||  argc == 5 )  &&  std::strcmp( argv[1], "complete" ) == 0;
+
+  if( !( building  ||  completing ) )
+  {
+    std::cerr << "Usage:  " << argv[0] << " build companies image [--ignore-case]\n"
+              << "        " << argv[0] << " complete image prefix [count]\n";
+    return 2;
+  }
+
+  try
+  {
+    if( building )  build( argv[2], argv[3], argc == 5 );
+    else            complete( argv[2], argv[3], argc == 5 ? std::strtoul( argv[4], nullptr, 10 ) : 10 );
+  }
+  catch( const std::exception & ex )
+  {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
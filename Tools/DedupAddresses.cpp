@@ -0,0 +1,112 @@
+/**
+ * File: DedupAddresses.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Copies a file of Address records (as written by operator<<) without its
+ *				duplicates, keeping the first occurrence of each address, and reports how
+ *				many were removed.  See Addresses/Deduplicator.hpp.
+ *
+ * Usage:  DedupAddresses input output [--memory MiB] [--temp directory] [--suppress file]
+ *
+ *				--memory     approximate memory to use, default 256 MiB
+ *				--temp       directory for spilled partitions, default the current directory
+ *				--suppress   a file of addresses to drop as well, e.g. a do not mail list
+ **/
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/Deduplicator.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  template <typename Function>
+  void forEachAddress( const std::string & path, Function function )
+  {
+    const Utilities::MappedFile file( path );
+    Addresses::Address          address;
+    Utilities::Records::forEachRecord( file.contents(), [&]( Utilities::StringView, const Utilities::Records::Fields & fields )
+    {
+      if( fromRecord( fields, address ) )  function( address );
+    } );
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  Addresses::Deduplicator::Options options;
+  std::string                      suppress;
+
+  int argument = 3;
+  for( ; argument + 1 < argc; argument += 2 )
+  {
+    if     ( std::strcmp( argv[argument], "--memory"   ) == 0 )  options.memoryBudget  = std::strtoul( argv[argument + 1], nullptr, 10 ) * 1024 * 1024;
+    else if( std::strcmp( argv[argument], "--temp"     ) == 0 )  options.tempDirectory = argv[argument + 1];
+    else if( std::strcmp( argv[argument], "--suppress" ) == 0 )  suppress              = argv[argument + 1];
+    else break;
+  }
+
+  if( argc < 3  ||  argument < argc  ||  options.memoryBudget == 0 )
+  {
+    std::cerr << "Usage:  " << argv[0] << " input output [--memory MiB] [--temp directory] [--suppress file]\n";
+    return 2;
+  }
+
+  std::ofstream output( argv[2], std::ios::binary );
+  if( !output )
+  {
+    std::cerr << "Unable to create \"" << argv[2] << "\"\n";
+    return 1;
+  }
+
+  try
+  {
+    std::string buffer;
+    Addresses::Deduplicator dedup( [&]( const Addresses::Address & address )
+    {
+      address.appendTo( buffer );
+      if( buffer.size() >= 1024 * 1024 )
+      {
+        output.write( buffer.data(), static_cast<std::streamsize>( buffer.size() ) );
+        buffer.clear();
+      }
+    }, options );
+
+    if( !suppress.empty() )  forEachAddress( suppress, [&dedup]( const Addresses::Address & address ) { dedup.remember( address ); } );
+    forEachAddress( argv[1], [&dedup]( const Addresses::Address & address ) { dedup.insert( address ); } );
+    dedup.finish();
+
+    output.write( buffer.data(), static_cast<std::streamsize>( buffer.size() ) );
+    if( !output.flush() )
+    {
+      std::cerr << "Unable to write \"" << argv[2] << "\"\n";
+      return 1;
+    }
+
+    const auto & statistics = dedup.statistics();
+    std::cout << "Records:             " << statistics.records << '\n'
+              << "Unique:              " << statistics.unique << '\n'
+              << "Duplicates removed:  " << statistics.duplicates
+              << " (" << ( statistics.records ? 100.0 * statistics.duplicates / statistics.records : 0 ) << "%)\n"
+              << "Partitions spilled:  " << statistics.spills << '\n'
+              << "Peak memory:         " << statistics.peakBytes / 1024 << " KB\n";
+  }
+  catch( const std::exception & ex )
+  {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
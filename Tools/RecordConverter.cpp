@@ -0,0 +1,121 @@
+/**
+ * File: RecordConverter.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Converts a file of Address, Company or Employee records between the
+ *				FIELD_SEPARATOR/RECORD_SEPARATOR text form written by the insertion
+ *				operators and the binary form written by serialize().
+ *
+ * Usage:  RecordConverter {address|company|employee} {to-binary|to-text} input output [--trusted]
+ *
+ *				--trusted skips re-validating states and zip codes when reading a binary
+ *				file this program wrote.
+ **/
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Addresses/Address.hpp"
+#include "Companies/Company.hpp"
+#include "Employees/Employee.hpp"
+#include "Utilities/Binary.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFile.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  template <typename T>
+  std::size_t toBinary( const std::string & input, std::ofstream & output )
+  {
+    Utilities::RecordFile     file( input );
+    Utilities::Binary::Buffer buffer;
+
+    std::size_t count = 0;
+    for( std::size_t i = 0; i < file.size(); ++i )
+    {
+      T record;
+      if( !fromRecord( file[i], record ) )  continue;   // holds nothing
+      record.serialize( buffer );
+      ++count;
+
+      // write in large pieces rather than holding the whole file
+      if( buffer.size() >= 1024 * 1024 )
+      {
+        output.write( buffer.data(), static_cast<std::streamsize>( buffer.size() ) );
+        buffer.clear();
+      }
+    }
+    output.write( buffer.data(), static_cast<std::streamsize>( buffer.size() ) );
+    return count;
+  }
+
+
+  template <typename T>
+  std::size_t toText( const std::string & input, std::ofstream & output, bool trusted )
+  {
+    Utilities::MappedFile        file( input );
+    Utilities::Binary::Reader    reader( file.contents(), trusted );
+
+    std::size_t count = 0;
+    for( T record; !reader.atEnd(); ++count )  output << record.deserialize( reader );
+    return count;
+  }
+
+
+  template <typename T>
+  std::size_t convert( bool binary, const std::string & input, std::ofstream & output, bool trusted )
+  {
+    return binary ? toBinary<T>( input, output ) : toText<T>( input, output, trusted );
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  if( argc < 5 || ( std::strcmp( argv[2], "to-binary" ) != 0 && std::strcmp( argv[2], "to-text" ) != 0 ) )
+  {
+    std::cerr << "Usage:  " << argv[0] << " {address|company|employee} {to-binary|to-text} input output [--trusted]\n";
+    return 2;
+  }
+
+  const std::string type    = argv[1];
+  const bool        binary  = std::strcmp( argv[2], "to-binary" ) == 0;
+  const bool        trusted = argc > 5 && std::strcmp( argv[5], "--trusted" ) == 0;
+
+  // check the type before creating the output, so a typo doesn't empty an existing file
+  std::size_t ( * converter )( bool, const std::string &, std::ofstream &, bool ) = nullptr;
+  if     ( type == "address"  )  converter = convert<Addresses::Address>;
+  else if( type == "company"  )  converter = convert<Companies::Company>;
+  else if( type == "employee" )  converter = convert<Employees::Employee>;
+  else
+  {
+    std::cerr << "Unknown record type \"" << type << "\"\n";
+    return 2;
+  }
+
+  std::ofstream output( argv[4], std::ios::binary );
+  if( !output )
+  {
+    std::cerr << "Unable to create \"" << argv[4] << "\"\n";
+    return 1;
+  }
+
+  try
+  {
+    const std::size_t count = converter( binary, argv[3], output, trusted );
+    std::cout << "Converted " << count << ' ' << type << " records\n";
+  }
+  catch( const std::exception & ex )
+  {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * File: SortAddresses.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Sorts a file of Address records (as written by operator<<) into
+ *				operator< order, even if the file is larger than memory.  See
+ *				Addresses/ExternalSort.hpp.
+ *
+ * Usage:  SortAddresses input output [--memory MiB] [--temp directory] [--fan-in runs] [--report]
+ *
+ *				--memory   approximate memory to use, default 256 MiB
+ *				--temp     directory for the temporary run files, default the current directory
+ *				--fan-in   most runs to merge at once, default as many as the memory allows
+ *				--report   prints the runs, merge passes, time and throughput
+ **/
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "Addresses/ExternalSort.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  void report( const Addresses::ExternalSort::Statistics & statistics )
+  {
+    constexpr double MIB = 1024.0 * 1024.0;
+
+    std::cout << "Records:         " << statistics.records                              << '\n'
+              << "Input:           " << statistics.inputBytes / MIB                     << " MiB\n"
+              << "Runs:            " << statistics.runs                                 << '\n'
+              << "Merge passes:    " << statistics.mergePasses                          << '\n'
+              << "Run bytes:       " << statistics.runBytes / MIB                       << " MiB\n"
+              << "Run formation:   " << statistics.runSeconds                           << " s\n"
+              << "Merging:         " << statistics.mergeSeconds                         << " s\n"
+              << "Throughput:      " << statistics.throughput() / MIB                   << " MiB/s, "
+                                     << ( statistics.seconds() > 0 ? statistics.records / statistics.seconds() : 0 ) << " records/s\n";
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  Addresses::ExternalSort::Options options;
+  bool                             reporting = false;
+
+  int argument = 3;
+  for( ; argument < argc; ++argument )
+  {
+    if     ( std::strcmp( argv[argument], "--report" ) == 0 )                     reporting = true;
+    else if( std::strcmp( argv[argument], "--memory" ) == 0  &&  argument + 1 < argc )  options.memoryBudget  = std::strtoul( argv[++argument], nullptr, 10 ) * 1024 * 1024;
+    else if( std::strcmp( argv[argument], "--temp"   ) == 0  &&  argument + 1 < argc )  options.tempDirectory = argv[++argument];
+    else if( std::strcmp( argv[argument], "--fan-in" ) == 0  &&  argument + 1 < argc )  options.maxFanIn      = std::strtoul( argv[++argument], nullptr, 10 );
+    else break;
+  }
+
+  if( argc < 3  ||  argument < argc  ||  options.memoryBudget == 0 )
+  {
+    std::cerr << "Usage:  " << argv[0] << " input output [--memory MiB] [--temp directory] [--fan-in runs] [--report]\n";
+    return 2;
+  }
+
+  try
+  {
+    const Addresses::ExternalSort::Statistics statistics = Addresses::ExternalSort::sortFile( argv[1], argv[2], options );
+
+    if( reporting )  report( statistics );
+    else             std::cout << "Sorted " << statistics.records << " address records\n";
+  }
+  catch( const std::exception & ex )
+  {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
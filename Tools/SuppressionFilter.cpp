@@ -0,0 +1,93 @@
+/**
+ * File: SuppressionFilter.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Builds a Bloom filter image from a file of Address records (e.g. a do not
+ *				mail list), or checks a file of addresses against one and reports how many
+ *				might be on the list.  See Addresses/AddressFilter.hpp.
+ *
+ * Usage:  SuppressionFilter build list image [--rate falsePositiveRate]     (default rate 0.01)
+ *         SuppressionFilter check image addresses
+ **/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "Addresses/Address.hpp"
+#include "Addresses/AddressFilter.hpp"
+#include "Utilities/BloomFilter.hpp"
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+
+
+namespace // unnamed, anonymous namespace for internal (local) linkage
+{
+  void build( const std::string & list, const std::string & image, double rate )
+  {
+    const Utilities::BloomFilter filter = Addresses::buildFilter( list, rate );
+    filter.save( image );
+
+    std::cout << "Addresses:          " << filter.size() << '\n'
+              << "Filter size:        " << filter.bytes() << " bytes ("
+                                        << ( filter.size() ? 8.0 * filter.bytes() / filter.size() : 0 ) << " bits per address)\n"
+              << "Hashes per address: " << filter.hashCount() << '\n';
+  }
+
+
+  void check( const std::string & image, const std::string & addresses )
+  {
+    const auto                   start  = std::chrono::steady_clock::now();
+    const Utilities::BloomFilter filter = Utilities::BloomFilter::load( image );
+    const Utilities::MappedFile  file( addresses );
+
+    std::size_t        records = 0;
+    std::size_t        maybe   = 0;
+    Addresses::Address address;
+    Utilities::Records::forEachRecord( file.contents(), [&]( Utilities::StringView, const Utilities::Records::Fields & fields )
+    {
+      if( !fromRecord( fields, address ) )  return;
+      ++records;
+      if( filter.mayContain( address ) )  ++maybe;
+    } );
+    const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "Addresses:          " << records << '\n'
+              << "Not on the list:    " << records - maybe << '\n'
+              << "Maybe on the list:  " << maybe << "  (need an exact check)\n"
+              << "Time:               " << seconds << " s\n";
+  }
+} // unnamed, anonymous namespace
+
+
+
+
+int main( int argc, char * argv[] )
+{
+  const bool building = argc >= 4  &&  std::strcmp( argv[1], "build" ) == 0;
+  const bool checking = argc == 4  &&  std::strcmp( argv[1], "check" ) == 0;
+  const bool rated    = building  &&  argc == 6  &&  std::strcmp( argv[4], "--rate" ) == 0;
+
+  if( !( checking  ||  ( building  &&  ( argc == 4  ||  rated ) ) ) )
+  {
+    std::cerr << "Usage:  " << argv[0] << " build list image [--rate falsePositiveRate]\n"
+              << "        " << argv[0] << " check image addresses\n";
+    return 2;
+  }
+
+  try
+  {
+    if( building )  build( argv[2], argv[3], rated ? std::strtod( argv[5], nullptr ) : 0.01 );
+    else            check( argv[2], argv[3] );
+  }
+  catch( const std::exception & ex )
+  {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
@@ -0,0 +1,161 @@
+/**
+ * File: Binary.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the binary record Buffer and Reader.
+ *				Values are assembled a byte at a time so the format is little endian on
+ *				every host and no read is ever unaligned.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Utilities/Binary.hpp"
+
+namespace Utilities {
+	namespace Binary {
+		/**********************
+		* Buffer queries
+		**********************/
+		const char * Buffer::data() const noexcept {
+			return _bytes.data();
+		}
+		std::size_t Buffer::size() const noexcept {
+			return _bytes.size();
+		}
+		StringView Buffer::view() const noexcept {
+			return StringView(_bytes.data(), _bytes.size());
+		}
+
+
+		/**********************
+		* Buffer modifiers
+		**********************/
+		Buffer & Buffer::put8(std::uint8_t value) {
+			_bytes += static_cast<char>(value);
+			return *this;
+		}
+
+		Buffer & Buffer::put32(std::uint32_t value) {
+			for (unsigned shift = 0; shift < 32; shift += 8) {
+				_bytes += static_cast<char>((value >> shift) & 0xFF);
+			}
+			return *this;
+		}
+
+		// 7 bits per byte, low bits first, the high bit set on every byte but the last
+		Buffer & Buffer::putVarint(std::uint64_t value) {
+			while (value >= 0x80) {
+				_bytes += static_cast<char>((value & 0x7F) | 0x80);
+				value >>= 7;
+			}
+			_bytes += static_cast<char>(value);
+			return *this;
+		}
+
+		Buffer & Buffer::putString(StringView text) {
+			putVarint(text.size());
+			_bytes.append(text.data(), text.size());
+			return *this;
+		}
+
+		std::size_t Buffer::beginRecord(RecordType type) {
+			const std::size_t record = _bytes.size();
+			put8(static_cast<std::uint8_t>(type));
+			put8(VERSION);
+			put32(0);  // length, filled in by endRecord()
+			return record;
+		}
+
+		void Buffer::endRecord(std::size_t record) {
+			const std::uint32_t length = static_cast<std::uint32_t>(_bytes.size() - record - HEADER_SIZE);
+			for (unsigned i = 0; i < 4; ++i) {
+				_bytes[record + 2 + i] = static_cast<char>((length >> (8 * i)) & 0xFF);
+			}
+		}
+
+		void Buffer::reserve(std::size_t bytes) {
+			_bytes.reserve(bytes);
+		}
+
+		void Buffer::clear() noexcept {
+			_bytes.clear();
+		}
+
+
+		/**********************
+		* Reader
+		**********************/
+		Reader::Reader(StringView bytes, bool trusted) noexcept
+			: _bytes(bytes), _trusted(trusted) {
+		}
+
+		bool Reader::atEnd() const noexcept {
+			return _bytes.empty();
+		}
+		std::size_t Reader::remaining() const noexcept {
+			return _bytes.size();
+		}
+		bool Reader::trusted() const noexcept {
+			return _trusted;
+		}
+
+		StringView Reader::take(std::size_t count) {
+			if (count > _bytes.size()) {
+				throw FormatException("Binary record is truncated", __LINE__, __func__, __FILE__);
+			}
+			const StringView taken = _bytes.substr(0, count);
+			_bytes.remove_prefix(count);
+			return taken;
+		}
+
+		std::uint8_t Reader::get8() {
+			return static_cast<std::uint8_t>(take(1)[0]);
+		}
+
+		std::uint32_t Reader::get32() {
+			const StringView bytes = take(4);
+			std::uint32_t value = 0;
+			for (unsigned i = 0; i < 4; ++i) {
+				value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+			}
+			return value;
+		}
+
+		std::uint64_t Reader::getVarint() {
+			std::uint64_t value = 0;
+			for (unsigned shift = 0; shift < 64; shift += 7) {
+				const std::uint8_t byte = get8();
+				value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0) {
+					return value;
+				}
+			}
+			throw FormatException("Binary varint is too long", __LINE__, __func__, __FILE__);
+		}
+
+		StringView Reader::getString() {
+			const std::uint64_t length = getVarint();
+			if (length > _bytes.size()) {
+				throw FormatException("Binary string is truncated", __LINE__, __func__, __FILE__);
+			}
+			return take(static_cast<std::size_t>(length));
+		}
+
+		Reader Reader::record(RecordType type) {
+			const std::uint8_t recordType = get8();
+			const std::uint8_t version    = get8();
+			const std::uint32_t length    = get32();
+
+			if (recordType != static_cast<std::uint8_t>(type)) {
+				throw FormatException("Binary record is not of the expected type", __LINE__, __func__, __FILE__);
+			}
+			if (version != VERSION) {
+				throw VersionException("Binary record version " + std::to_string(version) + " is not supported", __LINE__, __func__, __FILE__);
+			}
+			return Reader(take(length), _trusted);
+		}
+	}
+}
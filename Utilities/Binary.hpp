@@ -0,0 +1,121 @@
+/**
+ * File: Binary.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the binary record format used by the
+ *				Address, Company and Employee serialize() and deserialize() functions.
+ *				Every record starts with a header:
+ *
+ *				        type      1 byte     RecordType ('A', 'C' or 'E')
+ *				        version   1 byte     VERSION
+ *				        length    4 bytes    payload size, little endian
+ *
+ *				followed by the payload.  Integers in a payload are little endian and
+ *				strings are a varint length followed by the characters.  A file is just
+ *				records back to back.
+ *
+ *				Buffer writes records and Reader reads them back.  A Reader constructed
+ *				as trusted (i.e. over data this program wrote itself) tells deserialize()
+ *				it may skip re-validating states and zip codes.
+ **/
+
+#ifndef UTILITIES_Binary_hpp
+#define UTILITIES_Binary_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Utilities/Exceptions.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  namespace Binary
+  {
+    // Inner Exception Type Hierarchy Definition
+    struct BinaryExceptions       : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // Binary format exception base class
+    struct   FormatException      : BinaryExceptions               { using BinaryExceptions::BinaryExceptions;   };  // truncated, corrupt or wrong type of record
+    struct   VersionException     : BinaryExceptions               { using BinaryExceptions::BinaryExceptions;   };  // written by a different format version
+
+
+    constexpr std::uint8_t  VERSION     = 1;
+    constexpr std::size_t   HEADER_SIZE = 6;
+
+    enum class RecordType : std::uint8_t { ADDRESS = 'A', COMPANY = 'C', EMPLOYEE = 'E' };
+
+
+
+
+    class Buffer
+    {
+      public:
+        // Queries
+        const char *  data () const noexcept;
+        std::size_t   size () const noexcept;
+        StringView    view () const noexcept;
+
+
+        // Modifiers
+        Buffer &      put8        ( std::uint8_t   value );
+        Buffer &      put32       ( std::uint32_t  value );
+        Buffer &      putVarint   ( std::uint64_t  value );
+        Buffer &      putString   ( StringView     text  );
+
+        std::size_t   beginRecord ( RecordType type      );   // writes a header, returns where it starts
+        void          endRecord   ( std::size_t record   );   // fills in the length of the record begun at record
+
+        void          reserve     ( std::size_t bytes    );
+        void          clear       (                      ) noexcept;
+
+
+
+
+      private:
+        // Instance attribute (aka object state attributes)
+        std::string   _bytes;
+    };  // class Buffer
+
+
+
+
+    // Reads values from a range of bytes it does not own.  Every get throws FormatException rather than reading past the end.
+    class Reader
+    {
+      public:
+        explicit Reader( StringView bytes, bool trusted = false ) noexcept;
+
+
+        // Queries
+        bool          atEnd     () const noexcept;
+        std::size_t   remaining () const noexcept;
+        bool          trusted   () const noexcept;     // data came from this program, values were validated when written
+
+
+        // Modifiers
+        std::uint8_t   get8      ();
+        std::uint32_t  get32     ();
+        std::uint64_t  getVarint ();
+        StringView     getString ();                   // a view into the bytes being read
+
+        // Reads a record header, checking its type and version, and returns a Reader over just its payload.  This Reader moves past
+        // the whole record, so fields a payload doesn't read are skipped.
+        Reader         record    ( RecordType type );
+
+
+
+
+      private:
+        StringView    take( std::size_t count );
+
+        // Instance attribute (aka object state attributes)
+        StringView    _bytes;
+        bool          _trusted;
+    };  // class Reader
+  } // namespace Binary
+} // namespace Utilities
+#endif
@@ -0,0 +1,200 @@
+/**
+ * File: BloomFilter.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the BloomFilter class.  The
+ *				high 32 bits of an item's hash pick its block.  Its bit positions come
+ *				from multiplying the hash by successive powers of an odd constant, the top
+ *				9 bits of each product choosing one of the block's 512 bits.  (Double
+ *				hashing is cheaper, but an unlucky small step repeats positions, which
+ *				shows at low false positive rates.)
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "Utilities/BloomFilter.hpp"
+#include "Utilities/Hash.hpp"
+#include "Utilities/MappedFile.hpp"
+
+namespace Utilities {
+	namespace {
+		constexpr char          MAGIC[4]    = { 'M', 'S', 'B', 'F' };
+		constexpr std::uint8_t  VERSION     = 1;
+		constexpr std::size_t   HEADER_SIZE = 32;
+		constexpr std::size_t   BLOCK_BITS  = 512;
+		constexpr unsigned      MAX_HASHES  = 16;
+
+		// the hash of a fixed string:  different if the hash function (or the byte order it reads words in) is
+		std::uint64_t hashCheck() noexcept {
+			return Hash::string("Utilities::BloomFilter");
+		}
+
+		// The false positive rate of a blocked filter.  Items per block vary (Poisson distributed), and a block holding i items
+		// has each bit set with probability 1 - (1 - 1/512)^(hashes i); the textbook formula assumes every block is average.
+		double blockedRate(double bitsPerItem, unsigned hashes) {
+			const double perBlock = BLOCK_BITS / bitsPerItem;
+			const std::size_t last = static_cast<std::size_t>(perBlock + 10 * std::sqrt(perBlock) + 10);
+
+			double rate = 0;
+			for (std::size_t i = 0; i <= last; ++i) {
+				const double probability = std::exp(i * std::log(perBlock) - perBlock - std::lgamma(i + 1.0));
+				rate += probability * std::pow(1 - std::pow(1 - 1.0 / BLOCK_BITS, static_cast<double>(hashes * i)), hashes);
+			}
+			return rate;
+		}
+
+		// an item's next bit position is the top 9 bits of its hash times another power of this (odd, so no bits are lost)
+		constexpr std::uint64_t MULTIPLIER = 0x9E3779B97F4A7C15;
+	}
+
+	/**********************
+	* Constructors
+	**********************/
+	BloomFilter::BloomFilter(std::size_t expectedItems, double falsePositiveRate) {
+		if (!(falsePositiveRate > 0 && falsePositiveRate < 1)) {
+			throw BloomFilterExceptions("False positive rate must be greater than 0 and less than 1", __LINE__, __func__, __FILE__);
+		}
+
+		// start from the bits per item an unblocked filter needs, and add bits until the best number of hashes meets the rate
+		const double ln2 = std::log(2.0);
+		double bitsPerItem = std::max(1.0, -std::log(falsePositiveRate) / (ln2 * ln2));
+		for (;; bitsPerItem *= 1.02) {
+			double best = 1;
+			for (unsigned hashes = 1; hashes <= MAX_HASHES; ++hashes) {
+				const double rate = blockedRate(bitsPerItem, hashes);
+				if (rate < best) {
+					best    = rate;
+					_hashes = hashes;
+				}
+			}
+			if (best <= falsePositiveRate || bitsPerItem >= BLOCK_BITS) {
+				break;
+			}
+		}
+
+		const double bits = static_cast<double>(std::max<std::size_t>(expectedItems, 1)) * bitsPerItem;
+		allocate(static_cast<std::size_t>(std::ceil(bits / BLOCK_BITS)));
+	}
+
+	BloomFilter BloomFilter::load(const std::string & path) {
+		const MappedFile file(path);
+		const char * data = file.data();
+		if (file.size() < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+			throw BloomFilterExceptions("\"" + path + "\" is not a Bloom filter image", __LINE__, __func__, __FILE__);
+		}
+		if (static_cast<std::uint8_t>(data[4]) != VERSION) {
+			throw BloomFilterExceptions("\"" + path + "\" is a different Bloom filter image version", __LINE__, __func__, __FILE__);
+		}
+
+		std::uint64_t check;
+		std::uint64_t blocks;
+		std::uint64_t items;
+		std::memcpy(&check, data + 8, 8);
+		std::memcpy(&blocks, data + 16, 8);
+		std::memcpy(&items, data + 24, 8);
+		if (check != hashCheck()) {
+			throw BloomFilterExceptions("\"" + path + "\" was built with a different hash function", __LINE__, __func__, __FILE__);
+		}
+
+		BloomFilter filter;
+		filter._hashes = static_cast<std::uint8_t>(data[5]);
+		if (filter._hashes == 0 || filter._hashes > MAX_HASHES || blocks == 0 || (file.size() - HEADER_SIZE) / (BLOCK_WORDS * 8) != blocks ||
+			(file.size() - HEADER_SIZE) % (BLOCK_WORDS * 8) != 0) {
+			throw BloomFilterExceptions("\"" + path + "\" is truncated or corrupt", __LINE__, __func__, __FILE__);
+		}
+		filter.allocate(static_cast<std::size_t>(blocks));
+		std::memcpy(filter._words.data() + filter._first, data + HEADER_SIZE, file.size() - HEADER_SIZE);
+		filter._items = static_cast<std::size_t>(items);
+
+		return filter;
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	bool BloomFilter::mayContainHash(std::uint64_t hash) const noexcept {
+		const std::uint64_t * words = block(hash);
+		std::uint64_t position = hash;
+
+		for (unsigned i = 0; i < _hashes; ++i) {
+			position *= MULTIPLIER;
+			const unsigned bit = static_cast<unsigned>(position >> 55);
+			if ((words[bit >> 6] & (std::uint64_t(1) << (bit & 63))) == 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::size_t BloomFilter::size() const noexcept {
+		return _items;
+	}
+
+	std::size_t BloomFilter::bytes() const noexcept {
+		return _blocks * BLOCK_WORDS * sizeof(std::uint64_t);
+	}
+
+	unsigned BloomFilter::hashCount() const noexcept {
+		return _hashes;
+	}
+
+	void BloomFilter::save(const std::string & path) const {
+		char header[HEADER_SIZE] = {};
+		const std::uint64_t check  = hashCheck();
+		const std::uint64_t blocks = _blocks;
+		const std::uint64_t items  = _items;
+		std::memcpy(header, MAGIC, sizeof(MAGIC));
+		header[4] = static_cast<char>(VERSION);
+		header[5] = static_cast<char>(_hashes);
+		std::memcpy(header + 8, &check, 8);
+		std::memcpy(header + 16, &blocks, 8);
+		std::memcpy(header + 24, &items, 8);
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(header, HEADER_SIZE);
+		file.write(reinterpret_cast<const char *>(_words.data() + _first), static_cast<std::streamsize>(bytes()));
+		if (!file.flush()) {
+			throw BloomFilterExceptions("Unable to write \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	void BloomFilter::insertHash(std::uint64_t hash) noexcept {
+		std::uint64_t * words = _words.data() + (block(hash) - _words.data());
+		std::uint64_t position = hash;
+
+		for (unsigned i = 0; i < _hashes; ++i) {
+			position *= MULTIPLIER;
+			const unsigned bit = static_cast<unsigned>(position >> 55);
+			words[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+		}
+		++_items;
+	}
+
+
+	/**********************
+	* Blocks
+	**********************/
+	void BloomFilter::allocate(std::size_t blocks) {
+		_blocks = std::max<std::size_t>(blocks, 1);
+		_words.assign(_blocks * BLOCK_WORDS + BLOCK_WORDS - 1, 0);
+
+		const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(_words.data()) % (BLOCK_WORDS * sizeof(std::uint64_t));
+		_first = misalignment == 0 ? 0 : (BLOCK_WORDS * sizeof(std::uint64_t) - misalignment) / sizeof(std::uint64_t);
+	}
+
+	// multiply-shift maps the high 32 bits evenly onto the blocks
+	const std::uint64_t * BloomFilter::block(std::uint64_t hash) const noexcept {
+		return _words.data() + _first + (((hash >> 32) * _blocks) >> 32) * BLOCK_WORDS;
+	}
+}
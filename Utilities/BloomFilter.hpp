@@ -0,0 +1,116 @@
+/**
+ * File: BloomFilter.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the BloomFilter class, a blocked Bloom
+ *				filter:  a compact, approximate set that answers "definitely not present"
+ *				or "maybe present".  All the bits for one item are in one 64 byte block,
+ *				so a lookup touches a single cache line.
+ *
+ *				Items are added and looked up by their std::hash (for records, consistent
+ *				with operator==), or directly by a 64 bit hash.  The filter is sized for
+ *				an expected number of items and a false positive rate; adding more items
+ *				than expected raises the rate.
+ *
+ *				save() writes a binary image:  a 32 byte header (magic "MSBF", version,
+ *				hash count, a check value of the hash function, block count and item
+ *				count) followed by the blocks.  load() refuses an image whose check value
+ *				doesn't match this build's hash, since the stored bits would be meaningless.
+ *
+ *				Usage:
+ *				        Utilities::BloomFilter filter(list.size(), 0.01);
+ *				        for (const auto & address : list)  filter.insert(address);
+ *				        if (filter.mayContain(incoming) && exactList.count(incoming))  ...
+ **/
+
+#ifndef UTILITIES_BloomFilter_hpp
+#define UTILITIES_BloomFilter_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Utilities/Exceptions.hpp"
+
+
+
+
+namespace Utilities
+{
+  class BloomFilter
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct BloomFilterExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // bad parameters, or an image that can't be saved or loaded
+
+
+      // Constructors and Destructor
+      BloomFilter             ( const BloomFilter &  )          = delete;
+      BloomFilter             (       BloomFilter && ) noexcept = default;
+      BloomFilter & operator= ( const BloomFilter &  )          = delete;
+      BloomFilter & operator= (       BloomFilter && ) noexcept = default;
+     ~BloomFilter             (                      ) noexcept = default;
+
+      BloomFilter( std::size_t expectedItems, double falsePositiveRate );   // the rate must be greater than 0 and less than 1
+
+      static BloomFilter load( const std::string & path );   // throws MappedFile::MappedFileExceptions or BloomFilterExceptions
+
+
+      // Queries
+      bool          mayContainHash ( std::uint64_t hash ) const noexcept;
+      template <typename T>
+      bool          mayContain     ( const T & item     ) const noexcept;
+
+      std::size_t   size           () const noexcept;   // items inserted
+      std::size_t   bytes          () const noexcept;   // size of the bit array
+      unsigned      hashCount      () const noexcept;   // bits set per item
+
+      void          save           ( const std::string & path ) const;
+
+
+      // Modifiers
+      void          insertHash     ( std::uint64_t hash ) noexcept;
+      template <typename T>
+      void          insert         ( const T & item     ) noexcept;
+
+
+
+
+    private:
+      BloomFilter() = default;
+
+      void                    allocate ( std::size_t blocks );
+      const std::uint64_t *   block    ( std::uint64_t hash ) const noexcept;
+
+      // Instance attribute (aka object state attributes)
+      std::vector<std::uint64_t>   _words;          // the blocks, plus slack so the first one can start on a cache line
+      std::size_t                  _first  = 0;     // index of the first block's first word
+      std::size_t                  _blocks = 0;
+      unsigned                     _hashes = 0;
+      std::size_t                  _items  = 0;
+
+
+      // Class attributes
+      static constexpr std::size_t BLOCK_WORDS = 8;   // 512 bits, one cache line
+  };  // class BloomFilter
+
+
+
+
+  // Template member definitions
+  template <typename T>
+  bool BloomFilter::mayContain( const T & item ) const noexcept
+  {
+    return mayContainHash( std::hash<T>()( item ) );
+  }
+
+  template <typename T>
+  void BloomFilter::insert( const T & item ) noexcept
+  {
+    insertHash( std::hash<T>()( item ) );
+  }
+} // namespace Utilities
+#endif
@@ -26,14 +26,92 @@
 #define UTILITIES_Abstract_Exception_hpp
 
 #include <exception>
+#include <memory>       // shared_ptr
+#include <mutex>        // once_flag, call_once()
 #include <stdexcept>
 #include <string>
 #include <type_traits>  // is_base_of()
 #include <typeinfo>     // type_info returned from typeid()
+#include <utility>      // move()
 
 
 namespace Utilities
 {
+  /*************************************************************************************
+  ** Where and why an exception was thrown, shared by every copy of the exception object.  Nothing but the description is copied
+  ** when an exception is created:  the function and file names are expected to be __func__ and __FILE__ (or other strings that
+  ** outlive the exception) and are kept as pointers, and an exception built from a caught one just links to the caught one's
+  ** record.  The message returned by what() is formatted from the whole chain the first time it's asked for, exactly once even if
+  ** several threads ask at the same time.
+  *************************************************************************************/
+  class ExceptionRecord
+  {
+    public:
+      ExceptionRecord(std::string description, int lineNumber, const char * functionName, const char * fileName)
+      : _description {std::move(description)},
+        _lineNumber  {lineNumber},
+        _functionName{functionName},
+        _fileName    {fileName}
+      {}
+
+      // Links the exception this one was built from.  Causes from outside the Library's hierarchy only have their what() text.
+      void cause(std::shared_ptr<const ExceptionRecord> record, const char * typeName)  { _cause = std::move(record);  _causeType = typeName; }
+      void cause(const char * text)                                                     { _causeText = text; }
+
+
+      // The formatted message for an exception of type typeName.  The type is supplied by the caller because it must be the most
+      // derived type, which a record can't know.
+      const std::string & message(const char * typeName) const
+      {
+        std::call_once(_formatted, [this, typeName]
+        {
+          std::string message;
+          if (_cause != nullptr)  message = _cause->message(_causeType);
+          else                    message = _causeText;
+
+          std::string header{std::string{"Exception:  "} + typeName + '\n'};
+          header += std::string(header.size(), '-') + '\n';      // underline the header with just enough characters to match the header's size
+
+          message += header + _description + "\n**** thrown at line " + std::to_string(_lineNumber)
+                     + " in function \"" + _functionName + "\" in file \"" + _fileName + "\"\n\n\n\n";
+          _message = std::move(message);
+        });
+        return _message;
+      }
+
+
+    private:
+      std::string                              _description;
+      int                                      _lineNumber;
+      const char *                             _functionName;
+      const char *                             _fileName;
+
+      std::shared_ptr<const ExceptionRecord>   _cause;                // the Library exception this one was built from, if any
+      const char *                             _causeType = nullptr;
+      std::string                              _causeText;            // or the what() text of any other exception
+
+      mutable std::once_flag                   _formatted;
+      mutable std::string                      _message;
+  };
+
+
+
+  // The part of every Library exception that doesn't depend on the standard exception it extends, so an exception can link to a
+  // caught one of any AbstractException<> type.
+  class ChainedException
+  {
+    public:
+      std::shared_ptr<const ExceptionRecord> record() const noexcept  { return _record; }
+
+    protected:
+      explicit ChainedException(std::shared_ptr<ExceptionRecord> record) noexcept : _record{std::move(record)} {}
+      ~ChainedException() = default;
+
+      std::shared_ptr<ExceptionRecord>   _record;
+  };
+
+
+
   /*************************************************************************************
   ** As an error handling strategy, all exceptions generated from the Library package are derived from this Abstract Base Class
   ** (ABC), which by default extends the standard exception hierarchy.  A common extension to this pattern is for classes within the
@@ -46,7 +124,7 @@ namespace Utilities
   **         StandardException(const char *)) Note that class std::exception does not meet this concept.
   *************************************************************************************/
   template <typename StandardException = std::runtime_error>
-  class AbstractException : public StandardException  // Abstract Base Class
+  class AbstractException : public StandardException, public ChainedException  // Abstract Base Class
   {
     // Enforce derivation from standard exception hierarchy
     static_assert(std::is_base_of<std::exception, StandardException>::value, "AbstractException does not derive from std::exception");
@@ -73,52 +151,54 @@ namespace Utilities
       //           // do some work
       //           throw SomeOtherException (ex, "Some informative message", __LINE_, __func__, __FILE__); // Constructor (2)
       //         }
+      //
+      // functionName and fileName are not copied, so they must outlive the exception (__func__ and __FILE__ do).
 
       // (1)
-      AbstractException(const std::string &   description,
+      AbstractException(std::string           description,
                         const int             lineNumber,
-                        const std::string &   functionName,
-                        const std::string &   fileName)
+                        const char *          functionName,
+                        const char *          fileName)
 
-      : StandardException{description + "\n**** thrown at line " + std::to_string(lineNumber)
-                          + " in function \"" + functionName + "\" in file \"" + fileName + "\"\n"}
+      : StandardException{""},   // the description is kept in the record, see what()
+        ChainedException {std::make_shared<ExceptionRecord>(std::move(description), lineNumber, functionName, fileName)}
       {}
 
 
 
       // (2)
       AbstractException(const std::exception &   exception,
-                        const std::string    &   description,
+                        std::string              description,
                         const int                lineNumber,
-                        const std::string    &   functionName,
-                        const std::string    &   fileName
+                        const char *             functionName,
+                        const char *             fileName
                        )
-      : AbstractException{description, lineNumber, functionName, fileName}  // delegate construction
+      : AbstractException{std::move(description), lineNumber, functionName, fileName}  // delegate construction
       {
-        _description = exception.what();
+        // link a Library exception's record rather than copying its message
+        if (auto chained = dynamic_cast<const ChainedException *>(&exception))  _record->cause(chained->record(), typeid(exception).name());
+        else                                                                     _record->cause(exception.what());
       }
 
       // Returns the information contained in the exception object with some header information.  Note that the header includes the
       // name of the exception class as provided by operator typeid.  It's important that typeid not be executed in a base class
       // constructor as that would return the name of the base class and not the name of the most derived class.  In this case, the
       // name of the exception class is obtained when the client requests to see the contents of the message (i.e. function what()),
-      // not when the exception objects is created.
+      // not when the exception objects is created.  The message is formatted on the first call and the same text is returned after
+      // that; copies of an exception share it.
       const char * what() const noexcept override
       {
-        std::string header{std::string{"Exception:  "} + typeid(*this).name() + '\n'};
-        header += std::string(header.size(), '-') + '\n';      // underline the header with just enough characters to match the header's size
-
-        _description += header + StandardException::what() + "\n\n\n";
-        return _description.c_str();
+        try
+        {
+          if (_record != nullptr)  return _record->message(typeid(*this).name()).c_str();
+        }
+        catch (...)  // out of memory formatting the message
+        {}
+        return "Exception:  message unavailable";
       }
 
       // Pure virtual function prevents creation of objects, making this an abstract class
       ~AbstractException()  override = 0;
-
-
-    private:
-      mutable std::string   _description;  // used to hold the return value of function what(), which could be invoked on constant
-                                           // objects, hence the mutable qualifier
   };
 
   // Class member definitions
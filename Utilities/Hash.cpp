@@ -0,0 +1,62 @@
+/**
+ * File: Hash.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the byte range hash.  Each 8 byte
+ *				word (and the last partial word, zero padded) goes through xxHash64's
+ *				round and is folded into a single accumulator, which gets xxHash64's
+ *				avalanche at the end.  Record fields are short, so one accumulator is
+ *				faster than xxHash64's four.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Utilities/Hash.hpp"
+
+namespace Utilities {
+	namespace Hash {
+		namespace {
+			constexpr std::uint64_t PRIME1 = 0x9E3779B185EBCA87;
+			constexpr std::uint64_t PRIME2 = 0xC2B2AE3D27D4EB4F;
+			constexpr std::uint64_t PRIME3 = 0x165667B19E3779F9;
+			constexpr std::uint64_t PRIME4 = 0x85EBCA77C2B2AE63;
+			constexpr std::uint64_t PRIME5 = 0x27D4EB2F165667C5;
+
+			inline std::uint64_t rotate(std::uint64_t value, unsigned bits) noexcept {
+				return (value << bits) | (value >> (64 - bits));
+			}
+
+			inline std::uint64_t fold(std::uint64_t hash, std::uint64_t word) noexcept {
+				hash ^= rotate(word * PRIME2, 31) * PRIME1;
+				return rotate(hash, 27) * PRIME1 + PRIME4;
+			}
+		}
+
+		std::uint64_t bytes(const void * data, std::size_t size, std::uint64_t seed) noexcept {
+			const char * next = static_cast<const char *>(data);
+			std::uint64_t hash = seed + PRIME5 + size;
+
+			for (; size >= 8; size -= 8, next += 8) {
+				std::uint64_t word;
+				std::memcpy(&word, next, 8);
+				hash = fold(hash, word);
+			}
+			if (size > 0) {
+				std::uint64_t word = 0;
+				std::memcpy(&word, next, size);
+				hash = fold(hash, word);
+			}
+
+			// avalanche
+			hash ^= hash >> 33;
+			hash *= PRIME2;
+			hash ^= hash >> 29;
+			hash *= PRIME3;
+			hash ^= hash >> 32;
+			return hash;
+		}
+	}
+}
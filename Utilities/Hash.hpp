@@ -0,0 +1,128 @@
+/**
+ * File: Hash.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the record hashing support:  a fast, non
+ *				cryptographic 64 bit hash of a range of bytes, and Cache, a hash stored in
+ *				a record the first time it's asked for and forgotten when the record
+ *				changes.
+ *
+ *				bytes() reads 8 bytes at a time with xxHash64's round and final mix.  The
+ *				length is mixed into the starting value, so hashing several fields by
+ *				passing each result as the next field's seed can't confuse ("ab", "c")
+ *				with ("a", "bc").  Words are read in the machine's byte order, so hash
+ *				values differ between platforms; anything that stores them must check it
+ *				was built with the same hash (see BloomFilter).
+ *
+ *				Usage:
+ *				        std::uint64_t h = Utilities::Hash::bytes(first.data(), first.size());
+ *				        h               = Utilities::Hash::bytes(last.data(),  last.size(), h);
+ **/
+
+#ifndef UTILITIES_Hash_hpp
+#define UTILITIES_Hash_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  namespace Hash
+  {
+    std::uint64_t  bytes  ( const void * data, std::size_t size, std::uint64_t seed = 0 ) noexcept;
+    std::uint64_t  string ( StringView text,                      std::uint64_t seed = 0 ) noexcept;
+
+
+
+
+    // A hash computed on first use.  The owner calls reset() whenever a field the hash covers changes.  Copies keep the hash, a
+    // moved-from cache is reset (the moved-from strings are no longer what was hashed).  Threads may ask for the hash of the same
+    // unchanging record at once; they compute and store the same value.
+    class Cache
+    {
+      public:
+        // Constructors and Destructor
+        Cache             (                ) noexcept = default;
+        Cache             ( const Cache &  ) noexcept;
+        Cache             (       Cache && ) noexcept;
+        Cache & operator= ( const Cache &  ) noexcept;
+        Cache & operator= (       Cache && ) noexcept;
+       ~Cache             (                ) noexcept = default;
+
+
+        // Queries
+        template <typename Compute>
+        std::uint64_t  get   ( Compute compute ) const noexcept;   // the cached hash, or compute()'s, cached
+
+
+        // Modifiers
+        void           reset (                 ) noexcept;
+
+
+
+
+      private:
+        // Instance attribute (aka object state attributes)
+        mutable std::atomic<std::uint64_t>   _value { EMPTY };
+
+        // Class attributes
+        static constexpr std::uint64_t EMPTY       = 0;
+        static constexpr std::uint64_t EMPTY_ALIAS = 0x9E3779B97F4A7C15;  // stored for a computed hash of EMPTY
+    };  // class Cache
+
+
+
+
+    // Inline and template definitions
+    inline std::uint64_t string( StringView text, std::uint64_t seed ) noexcept
+    {
+      return bytes( text.data(), text.size(), seed );
+    }
+
+    inline Cache::Cache( const Cache & other ) noexcept
+    : _value( other._value.load( std::memory_order_relaxed ) )
+    {}
+
+    inline Cache::Cache( Cache && other ) noexcept
+    : _value( other._value.exchange( EMPTY, std::memory_order_relaxed ) )
+    {}
+
+    inline Cache & Cache::operator=( const Cache & other ) noexcept
+    {
+      _value.store( other._value.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+      return *this;
+    }
+
+    inline Cache & Cache::operator=( Cache && other ) noexcept
+    {
+      _value.store( other._value.exchange( EMPTY, std::memory_order_relaxed ), std::memory_order_relaxed );
+      return *this;
+    }
+
+    template <typename Compute>
+    std::uint64_t Cache::get( Compute compute ) const noexcept
+    {
+      std::uint64_t value = _value.load( std::memory_order_relaxed );
+      if( value == EMPTY )
+      {
+        value = compute();
+        if( value == EMPTY )  value = EMPTY_ALIAS;
+        _value.store( value, std::memory_order_relaxed );
+      }
+      return value;
+    }
+
+    inline void Cache::reset() noexcept
+    {
+      _value.store( EMPTY, std::memory_order_relaxed );
+    }
+  } // namespace Hash
+} // namespace Utilities
+#endif
@@ -0,0 +1,124 @@
+/**
+ * File: LoserTree.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the LoserTree class, a tournament tree for
+ *				k-way merging.  Each internal node remembers the loser of the match played
+ *				there, so after the winning source advances only the matches on its path
+ *				to the root are replayed:  log2(k) comparisons per item, against log2(k)
+ *				to 2 log2(k) for a binary heap.
+ *
+ *				The tree doesn't hold items.  It calls less(a, b) to ask whether source a's
+ *				current item comes before source b's.  Sources with equal items are taken
+ *				in source order, so merging runs of a stable sort is stable.
+ *
+ *				Usage:
+ *				        Utilities::LoserTree<decltype(less)> tree(runs.size(), less);
+ *				        while (!tree.empty()) {
+ *				          output(current[tree.winner()]);
+ *				          tree.replay(!advance(tree.winner()));   // true when that source has no more items
+ *				        }
+ **/
+
+#ifndef UTILITIES_LoserTree_hpp
+#define UTILITIES_LoserTree_hpp
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+
+
+namespace Utilities
+{
+  template <typename Less>
+  class LoserTree
+  {
+    public:
+      // Every source must have a current item
+      LoserTree( std::size_t sources, Less less );
+
+
+      // Queries
+      bool          empty  () const noexcept;     // every source is exhausted
+      std::size_t   winner () const noexcept;     // the source whose current item comes first
+
+
+      // Modifiers - call after the winner has moved to its next item, or with exhausted = true if it has none
+      void          replay ( bool exhausted = false );
+
+
+
+
+    private:
+      bool beats( std::size_t a, std::size_t b ) const;
+
+      // Instance attribute (aka object state attributes)
+      Less                       _less;
+      std::size_t                _sources;
+      std::vector<std::size_t>   _losers;      // _losers[node] for internal nodes 1 .. sources-1; source i is leaf sources + i
+      std::vector<bool>          _exhausted;
+      std::size_t                _winner = 0;
+  };  // class LoserTree
+
+
+
+
+  // Template member definitions
+  template <typename Less>
+  LoserTree<Less>::LoserTree( std::size_t sources, Less less )
+  : _less( std::move( less ) ), _sources( sources ), _losers( sources ), _exhausted( sources, false )
+  {
+    if( sources == 0 )  { _exhausted.push_back( true );  return; }
+
+    // play every match bottom up, keeping the loser at each node and passing the winner up
+    std::vector<std::size_t> winners( 2 * sources );
+    for( std::size_t source = 0; source < sources; ++source )  winners[sources + source] = source;
+    for( std::size_t node = sources - 1; node >= 1; --node )
+    {
+      const std::size_t a = winners[2 * node];
+      const std::size_t b = winners[2 * node + 1];
+      if( beats( a, b ) )  { winners[node] = a;  _losers[node] = b; }
+      else                 { winners[node] = b;  _losers[node] = a; }
+    }
+    _winner = sources == 1 ? 0 : winners[1];
+  }
+
+  template <typename Less>
+  bool LoserTree<Less>::empty() const noexcept
+  {
+    return _exhausted[_winner];
+  }
+
+  template <typename Less>
+  std::size_t LoserTree<Less>::winner() const noexcept
+  {
+    return _winner;
+  }
+
+  template <typename Less>
+  void LoserTree<Less>::replay( bool exhausted )
+  {
+    if( exhausted )  _exhausted[_winner] = true;
+
+    // replay the matches from the winner's leaf to the root
+    std::size_t candidate = _winner;
+    for( std::size_t node = ( _sources + _winner ) / 2; node >= 1; node /= 2 )
+    {
+      if( beats( _losers[node], candidate ) )  std::swap( _losers[node], candidate );
+    }
+    _winner = candidate;
+  }
+
+  // An exhausted source loses to everything; ties go to the lower source number with one comparison
+  template <typename Less>
+  bool LoserTree<Less>::beats( std::size_t a, std::size_t b ) const
+  {
+    if( _exhausted[a] )  return false;
+    if( _exhausted[b] )  return true;
+    return a < b ? !_less( b, a ) : _less( a, b );
+  }
+} // namespace Utilities
+#endif
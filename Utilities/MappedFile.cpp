@@ -0,0 +1,136 @@
+/**
+ * File: MappedFile.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the MappedFile class.
+ *				Uses mmap() on POSIX systems and file mapping objects on Windows.
+ **/
+
+#include <string>
+#include <utility>
+
+#include "Utilities/MappedFile.hpp"
+
+#if defined(_WIN32)
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Utilities {
+	/**********************
+	* Constructors
+	**********************/
+#if defined(_WIN32)
+	MappedFile::MappedFile(const std::string & path) {
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			throw MappedFileExceptions("Unable to open \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			throw MappedFileExceptions("Unable to get the size of \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+
+		// an empty file can't be mapped, and doesn't need to be
+		if (size.QuadPart > 0) {
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			const void * view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+			if (mapping != nullptr) {
+				CloseHandle(mapping);  // the view keeps the mapping alive
+			}
+			if (view == nullptr) {
+				CloseHandle(file);
+				throw MappedFileExceptions("Unable to map \"" + path + '"', __LINE__, __func__, __FILE__);
+			}
+			_data = static_cast<const char *>(view);
+			_size = static_cast<std::size_t>(size.QuadPart);
+		}
+		CloseHandle(file);
+	}
+#else
+	MappedFile::MappedFile(const std::string & path) {
+		const int file = ::open(path.c_str(), O_RDONLY);
+		if (file < 0) {
+			throw MappedFileExceptions("Unable to open \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+
+		struct stat status;
+		if (::fstat(file, &status) != 0) {
+			::close(file);
+			throw MappedFileExceptions("Unable to get the size of \"" + path + '"', __LINE__, __func__, __FILE__);
+		}
+
+		// an empty file can't be mapped, and doesn't need to be
+		if (status.st_size > 0) {
+			void * view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if (view == MAP_FAILED) {
+				::close(file);
+				throw MappedFileExceptions("Unable to map \"" + path + '"', __LINE__, __func__, __FILE__);
+			}
+			// records are read front to back
+			::madvise(view, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+
+			_data = static_cast<const char *>(view);
+			_size = static_cast<std::size_t>(status.st_size);
+		}
+		::close(file);  // the mapping stays valid after the file is closed
+	}
+#endif
+
+	MappedFile::MappedFile(MappedFile && rhs) noexcept
+		: _data(rhs._data), _size(rhs._size) {
+		rhs._data = nullptr;
+		rhs._size = 0;
+	}
+
+	MappedFile & MappedFile::operator=(MappedFile && rhs) noexcept {
+		if (this != &rhs) {
+			unmap();
+			std::swap(_data, rhs._data);
+			std::swap(_size, rhs._size);
+		}
+		return *this;
+	}
+
+	MappedFile::~MappedFile() noexcept {
+		unmap();
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	const char * MappedFile::data() const noexcept {
+		return _data;
+	}
+	std::size_t MappedFile::size() const noexcept {
+		return _size;
+	}
+	StringView MappedFile::contents() const noexcept {
+		return StringView(_data, _size);
+	}
+
+
+	/**********************
+	* Helpers
+	**********************/
+	void MappedFile::unmap() noexcept {
+		if (_data != nullptr) {
+#if defined(_WIN32)
+			UnmapViewOfFile(_data);
+#else
+			::munmap(const_cast<char *>(_data), _size);
+#endif
+			_data = nullptr;
+			_size = 0;
+		}
+	}
+}
@@ -0,0 +1,59 @@
+/**
+ * File: MappedFile.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the MappedFile class, a read only memory
+ *				mapping of a whole file.  The file's contents are read directly through the
+ *				mapping, without copying them through a stream buffer.
+ **/
+
+#ifndef UTILITIES_MappedFile_hpp
+#define UTILITIES_MappedFile_hpp
+
+#include <cstddef>
+#include <string>
+
+#include "Utilities/Exceptions.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  class MappedFile
+  {
+    public:
+      // Inner Exception Type Hierarchy Definition
+      struct MappedFileExceptions : Utilities::AbstractException<> { using AbstractException::AbstractException; };  // Class MappedFile exception base class
+
+
+      // Constructors and Destructor
+      MappedFile             (                     ) noexcept = default;
+      MappedFile             ( const MappedFile &  )          = delete;
+      MappedFile             (       MappedFile && ) noexcept;
+      MappedFile & operator= ( const MappedFile &  )          = delete;
+      MappedFile & operator= (       MappedFile && ) noexcept;
+     ~MappedFile             (                     ) noexcept;
+
+      explicit MappedFile( const std::string & path );    // throws MappedFileExceptions if the file can't be opened or mapped
+
+
+      // Queries
+      const char *  data     () const noexcept;           // nullptr for an empty file
+      std::size_t   size     () const noexcept;
+      StringView    contents () const noexcept;
+
+
+
+
+    private:
+      void unmap() noexcept;
+
+      // Instance attribute (aka object state attributes)
+      const char *  _data = nullptr;
+      std::size_t   _size = 0;
+  };  // class MappedFile
+} // namespace Utilities
+#endif
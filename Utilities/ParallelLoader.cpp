@@ -0,0 +1,42 @@
+/**
+ * File: ParallelLoader.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the non-template parts of the
+ *				parallel record loader.
+ **/
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "Utilities/ParallelLoader.hpp"
+
+namespace Utilities {
+	std::vector<StringView> shardRecords(StringView text, std::size_t shardCount) {
+		std::vector<StringView> shards;
+		if (shardCount == 0) {
+			shardCount = 1;
+		}
+
+		std::size_t begin = 0;
+		for (std::size_t shard = 1; shard <= shardCount && begin < text.size(); ++shard) {
+			// aim for an even split, then move forward past the end of the record the split lands in
+			std::size_t end = text.size();
+			if (shard < shardCount) {
+				end = text.find(Records::RECORD_SEPARATOR, std::max(begin, text.size() / shardCount * shard));
+				end = end == StringView::npos ? text.size() : end + 1;
+			}
+
+			shards.push_back(text.substr(begin, end - begin));
+			begin = end;
+		}
+		return shards;
+	}
+
+	std::size_t defaultThreadCount() noexcept {
+		const std::size_t threads = std::thread::hardware_concurrency();
+		return threads == 0 ? 1 : threads;
+	}
+}
@@ -0,0 +1,119 @@
+/**
+ * File: ParallelLoader.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the parallel record loader.  A memory mapped
+ *				file of records (see Records.hpp) is split into byte ranges that each start
+ *				at a record boundary, and the ranges are parsed and validated by a pool of
+ *				worker threads.  Records come back in file order.
+ *
+ *				Usage:
+ *				        std::vector<Addresses::Address> all = Utilities::loadParallel<Addresses::Address>("addresses.dat");
+ *
+ *				Like RecordFile::load(), the record type's fromRecord(StringView, T &) is
+ *				found through argument dependent lookup.  Records that hold nothing are left
+ *				out.  If any record fails to load, the exception thrown for the first bad
+ *				record in the file is rethrown.
+ **/
+
+#ifndef UTILITIES_ParallelLoader_hpp
+#define UTILITIES_ParallelLoader_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  // Splits text into at most shardCount consecutive, non-empty pieces.  Every piece but the first starts right after a
+  // RECORD_SEPARATOR, so no record is split between two pieces.
+  std::vector<StringView> shardRecords( StringView text, std::size_t shardCount );
+
+  // The number of worker threads used when none is given:  one per hardware thread
+  std::size_t defaultThreadCount() noexcept;
+
+
+  template <typename T>  std::vector<T>  loadParallel( StringView text, std::size_t threadCount = defaultThreadCount() );
+  template <typename T>  std::vector<T>  loadParallel( const std::string & path, std::size_t threadCount = defaultThreadCount() );
+
+
+
+
+  // Template definitions
+  template <typename T>
+  std::vector<T> loadParallel( StringView text, std::size_t threadCount )
+  {
+    if( threadCount == 0 )  threadCount = 1;
+
+    // more shards than threads so a thread that finishes early can pick up more work
+    constexpr std::size_t SHARDS_PER_THREAD = 4;
+    const std::vector<StringView>      shards = shardRecords( text, threadCount * SHARDS_PER_THREAD );
+    std::vector<std::vector<T>>        results( shards.size() );
+    std::vector<std::exception_ptr>    errors ( shards.size() );
+    std::atomic<std::size_t>           nextShard{ 0 };
+
+    auto worker = [&]()
+    {
+      for( std::size_t shard = nextShard++; shard < shards.size(); shard = nextShard++ )
+      {
+        try
+        {
+          std::vector<T> & result = results[shard];
+          Records::forEachRecord( shards[shard], [&result]( StringView, const Records::Fields & fields )
+          {
+            result.emplace_back();
+            if( !fromRecord( fields, result.back() ) )  result.pop_back();
+          } );
+        }
+        catch( ... )
+        {
+          errors[shard] = std::current_exception();  // the shard stops at its first bad record
+        }
+      }
+    };
+
+    // if a thread can't be started, the ones that were (and this one) take every shard; none may be left unjoined
+    std::vector<std::thread> pool;
+    try
+    {
+      for( std::size_t i = 1; i < threadCount && i < shards.size(); ++i )  pool.emplace_back( worker );
+    }
+    catch( ... ) {}
+    worker();  // the calling thread works too
+    for( auto & thread : pool )  thread.join();
+
+    // shards are in file order, so the first error found is the first bad record
+    std::size_t total = 0;
+    for( std::size_t shard = 0; shard < shards.size(); ++shard )
+    {
+      if( errors[shard] )  std::rethrow_exception( errors[shard] );
+      total += results[shard].size();
+    }
+
+    std::vector<T> records;
+    records.reserve( total );
+    for( auto & result : results )  records.insert( records.end(), std::make_move_iterator( result.begin() ), std::make_move_iterator( result.end() ) );
+    return records;
+  }
+
+  template <typename T>
+  std::vector<T> loadParallel( const std::string & path, std::size_t threadCount )
+  {
+    const MappedFile file( path );
+    return loadParallel<T>( file.contents(), threadCount );
+  }
+} // namespace Utilities
+#endif
@@ -0,0 +1,144 @@
+/**
+ * File: Postings.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of posting list compression and
+ *				intersection.  The SIMD intersections find which Ids of the left block
+ *				appear anywhere in the right block, then write those Ids out one mask bit
+ *				at a time.  Writing never gets ahead of reading, so out may be lhs.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Utilities/Postings.hpp"
+
+#ifdef UTILITIES_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+namespace Utilities {
+	namespace Postings {
+		namespace {
+			std::size_t intersectScalar(const std::uint32_t * lhs, std::size_t lhsCount, std::size_t i,
+				const std::uint32_t * rhs, std::size_t rhsCount, std::size_t j, std::uint32_t * out, std::size_t found) noexcept {
+				while (i < lhsCount && j < rhsCount) {
+					if (lhs[i] < rhs[j]) {
+						++i;
+					}
+					else if (rhs[j] < lhs[i]) {
+						++j;
+					}
+					else {
+						out[found++] = lhs[i];
+						++i;
+						++j;
+					}
+				}
+				return found;
+			}
+
+#ifdef UTILITIES_SIMD_X86
+			__attribute__((target("sse2")))
+			std::size_t intersectSse2(const std::uint32_t * lhs, std::size_t lhsCount, const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out) noexcept {
+				std::size_t i = 0, j = 0, found = 0;
+				while (i + 4 <= lhsCount && j + 4 <= rhsCount) {
+					const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs + i));
+					const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rhs + j));
+
+					__m128i equal = _mm_cmpeq_epi32(a, b);
+					equal = _mm_or_si128(equal, _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1))));
+					equal = _mm_or_si128(equal, _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))));
+					equal = _mm_or_si128(equal, _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3))));
+
+					const std::uint32_t lastA = lhs[i + 3];
+					const std::uint32_t lastB = rhs[j + 3];
+					for (unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal))); mask != 0; mask &= mask - 1) {
+						out[found++] = lhs[i + static_cast<unsigned>(__builtin_ctz(mask))];
+					}
+					i += lastA <= lastB ? 4 : 0;
+					j += lastB <= lastA ? 4 : 0;
+				}
+				return intersectScalar(lhs, lhsCount, i, rhs, rhsCount, j, out, found);
+			}
+
+			__attribute__((target("avx2")))
+			std::size_t intersectAvx2(const std::uint32_t * lhs, std::size_t lhsCount, const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out) noexcept {
+				const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+
+				std::size_t i = 0, j = 0, found = 0;
+				while (i + 8 <= lhsCount && j + 8 <= rhsCount) {
+					const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs + i));
+					__m256i       b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs + j));
+
+					__m256i equal = _mm256_cmpeq_epi32(a, b);
+					for (int r = 1; r < 8; ++r) {
+						b     = _mm256_permutevar8x32_epi32(b, rotate);
+						equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(a, b));
+					}
+
+					const std::uint32_t lastA = lhs[i + 7];
+					const std::uint32_t lastB = rhs[j + 7];
+					for (unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal))); mask != 0; mask &= mask - 1) {
+						out[found++] = lhs[i + static_cast<unsigned>(__builtin_ctz(mask))];
+					}
+					i += lastA <= lastB ? 8 : 0;
+					j += lastB <= lastA ? 8 : 0;
+				}
+				return intersectScalar(lhs, lhsCount, i, rhs, rhsCount, j, out, found);
+			}
+#endif
+		}
+
+		/***********************
+		* compression
+		**********************/
+		void encode(const std::uint32_t * ids, std::size_t count, std::vector<std::uint8_t> & bytes) {
+			std::uint32_t previous = 0;
+			for (std::size_t i = 0; i < count; ++i) {
+				std::uint32_t delta = ids[i] - previous;
+				previous = ids[i];
+				while (delta >= 0x80) {
+					bytes.push_back(static_cast<std::uint8_t>(delta | 0x80));
+					delta >>= 7;
+				}
+				bytes.push_back(static_cast<std::uint8_t>(delta));
+			}
+		}
+
+		std::size_t decode(const std::uint8_t * bytes, std::size_t count, std::uint32_t * ids) noexcept {
+			const std::uint8_t * next = bytes;
+			std::uint32_t id = 0;
+			for (std::size_t i = 0; i < count; ++i) {
+				std::uint32_t delta = *next & 0x7F;
+				for (unsigned shift = 7; *next++ & 0x80; shift += 7) {
+					delta |= static_cast<std::uint32_t>(*next & 0x7F) << shift;
+				}
+				id += delta;
+				ids[i] = id;
+			}
+			return static_cast<std::size_t>(next - bytes);
+		}
+
+
+		/***********************
+		* intersection
+		**********************/
+		std::size_t intersect(const std::uint32_t * lhs, std::size_t lhsCount, const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out) noexcept {
+			return intersect(lhs, lhsCount, rhs, rhsCount, out, Simd::available());
+		}
+
+		std::size_t intersect(const std::uint32_t * lhs, std::size_t lhsCount, const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out,
+			Simd::Isa isa) noexcept {
+			// never use more than the processor has
+			switch (Simd::clamp(isa)) {
+#ifdef UTILITIES_SIMD_X86
+				case Simd::Isa::AVX2:  return intersectAvx2(lhs, lhsCount, rhs, rhsCount, out);
+				case Simd::Isa::SSE2:  return intersectSse2(lhs, lhsCount, rhs, rhsCount, out);
+#endif
+				default:               return intersectScalar(lhs, lhsCount, 0, rhs, rhsCount, 0, out, 0);
+			}
+		}
+	}
+}
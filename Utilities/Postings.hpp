@@ -0,0 +1,106 @@
+/**
+ * File: Postings.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to posting list support for inverted indexes:
+ *				compressing a sorted list of record Ids and intersecting two of them.
+ *
+ *				A list is stored as the differences between consecutive Ids (the first
+ *				from 0), each written as a variable length integer:  7 bits per byte, low
+ *				bits first, the high bit set on every byte but the last.  Dense lists,
+ *				where the differences are small, take about one byte per Id.
+ *
+ *				intersect() compares a block of Ids from each list against every rotation
+ *				of the other block (4 Ids at a time with SSE2, 8 with AVX2), and advances
+ *				whichever block ends lower.  Lists must be strictly increasing.
+ *
+ *				A Cursor reads a list one Id at a time, for merging several lists without
+ *				decoding any of them whole.
+ *
+ *				Usage:
+ *				        std::vector<std::uint8_t> bytes;
+ *				        Utilities::Postings::encode(ids.data(), ids.size(), bytes);
+ *				        ...
+ *				        Utilities::Postings::decode(bytes.data(), count, ids.data());
+ **/
+
+#ifndef UTILITIES_Postings_hpp
+#define UTILITIES_Postings_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/Simd.hpp"
+
+
+
+
+namespace Utilities
+{
+  namespace Postings
+  {
+    // Appends count Ids, which must be increasing, to bytes
+    void          encode    ( const std::uint32_t * ids, std::size_t count, std::vector<std::uint8_t> & bytes );
+
+    // Reads count Ids into ids, which must hold count.  Returns the number of bytes read.
+    std::size_t   decode    ( const std::uint8_t * bytes, std::size_t count, std::uint32_t * ids ) noexcept;
+
+    // Reads a list of count Ids in order, decoding each as it's reached
+    class Cursor
+    {
+      public:
+        Cursor( const std::uint8_t * bytes, std::size_t count ) noexcept;
+
+        // Queries
+        bool            atEnd () const noexcept;
+        std::uint32_t   id    () const noexcept;   // the current Id, if not atEnd()
+
+        // Modifiers
+        void            next  ()       noexcept;   // moves to the next Id, if not atEnd()
+
+      private:
+        std::uint32_t   delta ()       noexcept;
+
+        // Instance attribute (aka object state attributes)
+        const std::uint8_t *   _bytes;
+        std::size_t            _left;     // Ids not yet passed, including the current one
+        std::uint32_t          _id = 0;
+    };  // class Cursor
+
+
+    // Writes the Ids in both lists to out, which must hold the shorter list, in order.  Returns the number written.  out may be
+    // lhs.  Uses the widest instruction set the processor supports unless told otherwise, the results are the same for all of them.
+    std::size_t   intersect ( const std::uint32_t * lhs, std::size_t lhsCount,
+                              const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out ) noexcept;
+    std::size_t   intersect ( const std::uint32_t * lhs, std::size_t lhsCount,
+                              const std::uint32_t * rhs, std::size_t rhsCount, std::uint32_t * out, Simd::Isa isa ) noexcept;
+
+
+
+
+    // Inline definitions
+    inline Cursor::Cursor( const std::uint8_t * bytes, std::size_t count ) noexcept
+    : _bytes( bytes ), _left( count )
+    {
+      if( _left != 0 )  _id = delta();
+    }
+
+    inline bool           Cursor::atEnd() const noexcept  { return _left == 0; }
+    inline std::uint32_t  Cursor::id   () const noexcept  { return _id;        }
+
+    inline void Cursor::next() noexcept
+    {
+      if( --_left != 0 )  _id += delta();
+    }
+
+    inline std::uint32_t Cursor::delta() noexcept
+    {
+      std::uint32_t value = *_bytes & 0x7F;
+      for( unsigned shift = 7; *_bytes++ & 0x80; shift += 7 )  value |= static_cast<std::uint32_t>( *_bytes & 0x7F ) << shift;
+      return value;
+    }
+  } // namespace Postings
+} // namespace Utilities
+#endif
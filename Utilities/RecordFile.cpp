@@ -0,0 +1,47 @@
+/**
+ * File: RecordFile.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the RecordFile class.
+ **/
+
+#include <string>
+
+#include "Utilities/RecordFile.hpp"
+#include "Utilities/RecordFramer.hpp"
+
+namespace Utilities {
+	/**********************
+	* Constructors
+	**********************/
+	RecordFile::RecordFile(const std::string & path)
+		: _file(path) {
+		const char * begin = _file.data();
+
+		Records::forEachRecord(_file.contents(), [this, begin](StringView record, const Records::Fields &) {
+			_ends.push_back(static_cast<std::size_t>(record.data() + record.size() - begin));
+		});
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	std::size_t RecordFile::size() const noexcept {
+		return _ends.size();
+	}
+
+	StringView RecordFile::operator[](std::size_t i) const noexcept {
+		const std::size_t start = i == 0 ? 0 : _ends[i - 1] + 1;
+		return StringView(_file.data() + start, _ends[i] - start);
+	}
+
+	Records::Fields RecordFile::fields(std::size_t i) const noexcept {
+		return Records::split((*this)[i]);
+	}
+
+	const MappedFile & RecordFile::file() const noexcept {
+		return _file;
+	}
+}
@@ -0,0 +1,97 @@
+/**
+ * File: RecordFile.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the RecordFile class, a bulk loader for
+ *				files of FIELD_SEPARATOR/RECORD_SEPARATOR delimited records (see Records.hpp)
+ *				such as the ones written by the Address, Company and Employee insertion
+ *				operators.  The file is memory mapped and records are handed out as views
+ *				into the mapping; objects are only built when asked for.
+ *
+ *				Usage:
+ *				        Utilities::RecordFile file("addresses.dat");
+ *				        Addresses::Address first = file.load<Addresses::Address>(0);
+ *				        std::vector<Addresses::Address> all = file.loadAll<Addresses::Address>();
+ *
+ *				load() finds the record type's fromRecord(StringView, T &) function through
+ *				argument dependent lookup.
+ **/
+
+#ifndef UTILITIES_RecordFile_hpp
+#define UTILITIES_RecordFile_hpp
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Utilities/MappedFile.hpp"
+#include "Utilities/Records.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  class RecordFile
+  {
+    public:
+      // Constructors and Destructor
+      RecordFile             (                     )          = default;
+      RecordFile             ( const RecordFile &  )          = delete;
+      RecordFile             (       RecordFile && )          = default;
+      RecordFile & operator= ( const RecordFile &  )          = delete;
+      RecordFile & operator= (       RecordFile && )          = default;
+     ~RecordFile             (                     ) noexcept = default;
+
+      explicit RecordFile( const std::string & path );     // maps the file and finds every record, throws MappedFile::MappedFileExceptions
+
+
+      // Queries
+      std::size_t       size       (                 ) const noexcept;  // number of records
+      StringView        operator[] ( std::size_t i   ) const noexcept;  // text of record i, without its RECORD_SEPARATOR
+      Records::Fields   fields     ( std::size_t i   ) const noexcept;
+      const MappedFile &  file     (                 ) const noexcept;
+
+
+      // Materialization - builds record i as a T, with the same validation (and exceptions) as T's extraction operator.  load()
+      // returns a default constructed T for a record that holds nothing; loadAll() leaves such records out.
+      template <typename T>  T               load    ( std::size_t i ) const;
+      template <typename T>  std::vector<T>  loadAll (               ) const;
+
+
+
+
+    private:
+      // Instance attribute (aka object state attributes)
+      MappedFile                  _file;
+      std::vector<std::size_t>    _ends;   // offset of each record's RECORD_SEPARATOR (or of the end of the file for the last record)
+  };  // class RecordFile
+
+
+
+
+  // Template member definitions
+  template <typename T>
+  T RecordFile::load( std::size_t i ) const
+  {
+    T record;
+    fromRecord( (*this)[i], record );
+    return record;
+  }
+
+  template <typename T>
+  std::vector<T> RecordFile::loadAll() const
+  {
+    std::vector<T> records;
+    records.reserve( size() );
+    for( std::size_t i = 0; i < size(); ++i )
+    {
+      records.emplace_back();
+      if( !fromRecord( (*this)[i], records.back() ) )  records.pop_back();
+    }
+    return records;
+  }
+} // namespace Utilities
+#endif
@@ -0,0 +1,88 @@
+/**
+ * File: RecordFramer.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of the record framer's separator search.
+ *				Separators are a few characters apart in typical records, so the set bits
+ *				of each mask are written out without branching on whether there are any.
+ **/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Utilities/RecordFramer.hpp"
+#include "Utilities/Simd.hpp"
+
+#ifdef UTILITIES_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+namespace Utilities {
+	namespace Records {
+		namespace {
+			std::size_t findScalar(const char * data, std::size_t begin, std::size_t size, std::uint32_t * offsets, std::size_t found) noexcept {
+				for (std::size_t i = begin; i < size; ++i) {
+					offsets[found] = static_cast<std::uint32_t>(i);
+					found += data[i] == FIELD_SEPARATOR || data[i] == RECORD_SEPARATOR;
+				}
+				return found;
+			}
+
+#ifdef UTILITIES_SIMD_X86
+			// appends the positions of the set bits of mask, offset by base
+			inline std::size_t appendBits(std::uint32_t mask, std::size_t base, std::uint32_t * offsets, std::size_t found) noexcept {
+				while (mask != 0) {
+					offsets[found++] = static_cast<std::uint32_t>(base + static_cast<unsigned>(__builtin_ctz(mask)));
+					mask &= mask - 1;
+				}
+				return found;
+			}
+
+			__attribute__((target("sse2")))
+			std::size_t findSse2(const char * data, std::size_t size, std::uint32_t * offsets) noexcept {
+				const __m128i field  = _mm_set1_epi8(FIELD_SEPARATOR);
+				const __m128i record = _mm_set1_epi8(RECORD_SEPARATOR);
+
+				std::size_t found = 0;
+				std::size_t i = 0;
+				for (; i + 16 <= size; i += 16) {
+					const __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+					const __m128i isSeparator = _mm_or_si128(_mm_cmpeq_epi8(text, field), _mm_cmpeq_epi8(text, record));
+					found = appendBits(static_cast<std::uint32_t>(_mm_movemask_epi8(isSeparator)), i, offsets, found);
+				}
+				return findScalar(data, i, size, offsets, found);
+			}
+
+			__attribute__((target("avx2")))
+			std::size_t findAvx2(const char * data, std::size_t size, std::uint32_t * offsets) noexcept {
+				const __m256i field  = _mm256_set1_epi8(FIELD_SEPARATOR);
+				const __m256i record = _mm256_set1_epi8(RECORD_SEPARATOR);
+
+				std::size_t found = 0;
+				std::size_t i = 0;
+				for (; i + 32 <= size; i += 32) {
+					const __m256i text = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+					const __m256i isSeparator = _mm256_or_si256(_mm256_cmpeq_epi8(text, field), _mm256_cmpeq_epi8(text, record));
+					found = appendBits(static_cast<std::uint32_t>(_mm256_movemask_epi8(isSeparator)), i, offsets, found);
+				}
+				return findScalar(data, i, size, offsets, found);
+			}
+#endif
+		}
+
+		std::size_t findSeparators(const char * data, std::size_t size, std::uint32_t * offsets) noexcept {
+			return findSeparators(data, size, offsets, Simd::available());
+		}
+
+		std::size_t findSeparators(const char * data, std::size_t size, std::uint32_t * offsets, Simd::Isa isa) noexcept {
+			switch (Simd::clamp(isa)) {
+#ifdef UTILITIES_SIMD_X86
+				case Simd::Isa::AVX2:  return findAvx2(data, size, offsets);
+				case Simd::Isa::SSE2:  return findSse2(data, size, offsets);
+#endif
+				default:               return findScalar(data, 0, size, offsets, 0);
+			}
+		}
+	}
+}
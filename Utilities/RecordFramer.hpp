@@ -0,0 +1,104 @@
+/**
+ * File: RecordFramer.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the record framer, which finds the field and
+ *				record boundaries of a buffer of records (see Records.hpp) in one pass.  The
+ *				buffer is compared against both separators 16 (SSE2) or 32 (AVX2) characters
+ *				at a time, and each comparison is reduced to a bit mask whose set bits are the
+ *				separator positions.
+ *
+ *				Usage:
+ *				        Utilities::Records::forEachRecord(text, [](Utilities::StringView record, const Utilities::Records::Fields & fields)
+ *				        {
+ *				          Addresses::Address address;
+ *				          fromRecord(fields, address);
+ *				        });
+ **/
+
+#ifndef UTILITIES_RecordFramer_hpp
+#define UTILITIES_RecordFramer_hpp
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/Records.hpp"
+#include "Utilities/Simd.hpp"
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  namespace Records
+  {
+    // The offset index:  writes the offset of every FIELD_SEPARATOR and RECORD_SEPARATOR in data[0, size) to offsets, in order,
+    // and returns how many were found.  offsets must have room for size entries and size must be less than MAX_SCAN.
+    constexpr std::size_t MAX_SCAN = std::size_t{1} << 31;
+
+    std::size_t findSeparators ( const char * data, std::size_t size, std::uint32_t * offsets ) noexcept;
+    std::size_t findSeparators ( const char * data, std::size_t size, std::uint32_t * offsets, Simd::Isa isa ) noexcept;
+
+
+    // Frames every record of text, in order.  onRecord(StringView record, const Fields & fields) is called with the text of each
+    // record (without its RECORD_SEPARATOR) and its fields, split the same way split() would.  A last record without a
+    // RECORD_SEPARATOR is still a record.  Text of any size is framed a chunk at a time.
+    template <typename Function>
+    void forEachRecord( StringView text, Function onRecord, Simd::Isa isa = Simd::available() );
+
+
+
+
+    // Template definitions
+    template <typename Function>
+    void forEachRecord( StringView text, Function onRecord, Simd::Isa isa )
+    {
+      constexpr std::size_t CHUNK_SIZE = 256 * 1024;   // keeps the offset index in cache
+
+      std::vector<std::uint32_t> offsets( std::min( text.size(), CHUNK_SIZE ) );
+
+      const char *  data        = text.data();
+      std::size_t   recordStart = 0;
+      std::size_t   fieldStart  = 0;
+      Fields        fields;
+
+      for( std::size_t chunk = 0; chunk < text.size(); chunk += CHUNK_SIZE )
+      {
+        const std::size_t size  = std::min( CHUNK_SIZE, text.size() - chunk );
+        const std::size_t found = findSeparators( data + chunk, size, offsets.data(), isa );
+
+        for( std::size_t i = 0; i < found; ++i )
+        {
+          const std::size_t position = chunk + offsets[i];
+
+          if( data[position] == FIELD_SEPARATOR )
+          {
+            if( fields.count < MAX_FIELDS )  fields.field[fields.count++] = text.substr( fieldStart, position - fieldStart );
+          }
+          else
+          {
+            // a field after the last FIELD_SEPARATOR only counts if it has characters, just like std::getline
+            if( fields.count < MAX_FIELDS  &&  fieldStart < position )  fields.field[fields.count++] = text.substr( fieldStart, position - fieldStart );
+
+            onRecord( text.substr( recordStart, position - recordStart ), static_cast<const Fields &>( fields ) );
+            fields      = Fields();
+            recordStart = position + 1;
+          }
+          fieldStart = position + 1;
+        }
+      }
+
+      // last record without a RECORD_SEPARATOR
+      if( recordStart < text.size() )
+      {
+        if( fields.count < MAX_FIELDS  &&  fieldStart < text.size() )  fields.field[fields.count++] = text.substr( fieldStart );
+        onRecord( text.substr( recordStart ), static_cast<const Fields &>( fields ) );
+      }
+    }
+  } // namespace Records
+} // namespace Utilities
+#endif
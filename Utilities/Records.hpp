@@ -0,0 +1,123 @@
+/**
+ * File: Records.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file describes the text record format shared by Address, Company and
+ *				Employee:  fields end with FIELD_SEPARATOR and records end with
+ *				RECORD_SEPARATOR.  split() breaks a record into its fields the same way the
+ *				stream extraction operators do, without copying any characters.  append(),
+ *				format() and write() go the other way, joining fields into a record without
+ *				a stream or temporary strings.
+ **/
+
+#ifndef UTILITIES_Records_hpp
+#define UTILITIES_Records_hpp
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  namespace Records
+  {
+    constexpr char FIELD_SEPARATOR  = '\x03';  // ETX (End of Text) character
+    constexpr char RECORD_SEPARATOR = '\x04';  // EOT (End of Transmission) character ('\n' turns out to not be a good choice because data
+                                               //     files are not then portable between Windows, Unix, and Mac OSs.)
+
+    constexpr std::size_t MAX_FIELDS = 4;      // the most fields any record type has (Address)
+
+
+    // The fields of one record.  count is the number of fields present, the same number of std::getline() calls that would have
+    // succeeded on the record; fields past count are empty.  Text past the last of MAX_FIELDS fields is ignored.
+    struct Fields
+    {
+      StringView    field[MAX_FIELDS];
+      std::size_t   count = 0;
+    };
+
+
+    // Splits a record (without its RECORD_SEPARATOR) into fields
+    inline Fields split( StringView record ) noexcept
+    {
+      Fields fields;
+      std::size_t position = 0;
+      while( fields.count < MAX_FIELDS  &&  position < record.size() )
+      {
+        std::size_t end = record.find( FIELD_SEPARATOR, position );
+        if( end == StringView::npos )  end = record.size();
+
+        fields.field[fields.count++] = record.substr( position, end - position );
+        position = end + 1;
+      }
+      return fields;
+    }
+
+
+    // Joins fields (at least one) into a record:  FIELD_SEPARATOR between fields and RECORD_SEPARATOR at the end
+    inline std::size_t length( std::initializer_list<StringView> fields ) noexcept
+    {
+      std::size_t size = fields.size();  // one separator per field
+      for( const auto & field : fields )  size += field.size();
+      return size;
+    }
+
+    inline void append( std::string & record, std::initializer_list<StringView> fields )
+    {
+      record.reserve( record.size() + length( fields ) );
+      for( const auto & field : fields )
+      {
+        record.append( field.data(), field.size() );
+        record += FIELD_SEPARATOR;
+      }
+      record.back() = RECORD_SEPARATOR;
+    }
+
+    // Returns the record's length, and only writes it to buffer if it fits in size characters
+    inline std::size_t format( char * buffer, std::size_t size, std::initializer_list<StringView> fields ) noexcept
+    {
+      const std::size_t recordLength = length( fields );
+      if( recordLength <= size )
+      {
+        for( const auto & field : fields )
+        {
+          if( field.size() > 0 )  std::memcpy( buffer, field.data(), field.size() );
+          buffer   += field.size();
+          *buffer++ = FIELD_SEPARATOR;
+        }
+        buffer[-1] = RECORD_SEPARATOR;
+      }
+      return recordLength;
+    }
+
+
+    // Writes a record's text with its formatTo() and appendTo() functions.  Records that fit are formatted on the stack, so
+    // writing them allocates nothing.
+    template <typename Record>
+    std::ostream & write( std::ostream & s, const Record & record )
+    {
+      char buffer[256];
+      const std::size_t size = record.formatTo( buffer, sizeof( buffer ) );
+      if( size <= sizeof( buffer ) )
+      {
+        s.write( buffer, static_cast<std::streamsize>( size ) );
+      }
+      else
+      {
+        std::string text;
+        record.appendTo( text );
+        s.write( text.data(), static_cast<std::streamsize>( text.size() ) );
+      }
+      return s;
+    }
+  } // namespace Records
+} // namespace Utilities
+#endif
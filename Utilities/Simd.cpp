@@ -0,0 +1,37 @@
+/**
+ * File: Simd.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the implementation of run time instruction set selection.
+ **/
+
+#include "Utilities/Simd.hpp"
+
+namespace Utilities {
+	namespace Simd {
+		namespace {
+			Isa detect() noexcept {
+#ifdef UTILITIES_SIMD_X86
+				__builtin_cpu_init();
+				if (__builtin_cpu_supports("avx2")) {
+					return Isa::AVX2;
+				}
+				if (__builtin_cpu_supports("sse2")) {
+					return Isa::SSE2;
+				}
+#endif
+				return Isa::SCALAR;
+			}
+		}
+
+		Isa available() noexcept {
+			static const Isa isa = detect();
+			return isa;
+		}
+
+		Isa clamp(Isa requested) noexcept {
+			return requested > available() ? available() : requested;
+		}
+	}
+}
@@ -0,0 +1,35 @@
+/**
+ * File: Simd.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to run time instruction set selection for the
+ *				SIMD code paths (batch zip code validation, record framing, ...).  Each SIMD
+ *				routine has a scalar fallback and is picked with available() at run time, so
+ *				the same build runs on any processor.
+ **/
+
+#ifndef UTILITIES_Simd_hpp
+#define UTILITIES_Simd_hpp
+
+// SSE2 and AVX2 code paths are compiled with gcc (and compatible) compilers for x86 targets, and selected per function with
+// __attribute__((target(...))).  Everything else gets the scalar paths only.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define UTILITIES_SIMD_X86 1
+#endif
+
+
+
+
+namespace Utilities
+{
+  namespace Simd
+  {
+    // Ordered from narrowest to widest
+    enum class Isa { SCALAR, SSE2, AVX2 };
+
+    Isa available ( ) noexcept;                    // the widest instruction set the processor supports
+    Isa clamp     ( Isa requested ) noexcept;      // requested, or available() if the processor doesn't support requested
+  } // namespace Simd
+} // namespace Utilities
+#endif
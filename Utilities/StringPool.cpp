@@ -0,0 +1,119 @@
+/**
+ * File: StringPool.cpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the class implementation for the StringPool class.
+ **/
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "Utilities/StringPool.hpp"
+
+namespace Utilities {
+	constexpr std::size_t StringPool::BLOCK_SIZE;
+
+	/**********************
+	* Constructors
+	**********************/
+	// the views in the other pool point into its blocks, so the strings are interned again in Id order
+	StringPool::StringPool(const StringPool & rhs) {
+		_strings.reserve(rhs._strings.size());
+		_ids.reserve(rhs._ids.size());
+		for (const auto & text : rhs._strings) {
+			intern(text);
+		}
+	}
+
+	// the blocks move, so views into them stay valid; the other pool's counters must not describe blocks it no longer has
+	StringPool::StringPool(StringPool && rhs) noexcept
+		: _blocks(std::move(rhs._blocks)), _blockUsed(rhs._blockUsed), _blockCapacity(rhs._blockCapacity), _bytes(rhs._bytes),
+		  _strings(std::move(rhs._strings)), _ids(std::move(rhs._ids)) {
+		rhs._blocks.clear();
+		rhs._blockUsed = rhs._blockCapacity = rhs._bytes = 0;
+		rhs._strings.clear();
+		rhs._ids.clear();
+	}
+
+	StringPool & StringPool::operator=(StringPool && rhs) noexcept {
+		if (this != &rhs) {
+			_blocks        = std::move(rhs._blocks);
+			_blockUsed     = rhs._blockUsed;
+			_blockCapacity = rhs._blockCapacity;
+			_bytes         = rhs._bytes;
+			_strings       = std::move(rhs._strings);
+			_ids           = std::move(rhs._ids);
+
+			rhs._blocks.clear();
+			rhs._blockUsed = rhs._blockCapacity = rhs._bytes = 0;
+			rhs._strings.clear();
+			rhs._ids.clear();
+		}
+		return *this;
+	}
+
+	StringPool & StringPool::operator=(const StringPool & rhs) {
+		if (this != &rhs) {
+			StringPool copy(rhs);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+
+	/**********************
+	* Queries
+	**********************/
+	StringView StringPool::operator[](Id id) const noexcept {
+		return _strings[id];
+	}
+
+	bool StringPool::find(StringView text, Id & id) const {
+		auto itr = _ids.find(text);
+		if (itr == _ids.cend()) {
+			return false;
+		}
+		id = itr->second;
+		return true;
+	}
+
+	std::size_t StringPool::size() const noexcept {
+		return _strings.size();
+	}
+
+	std::size_t StringPool::bytes() const noexcept {
+		return _bytes;
+	}
+
+
+	/**********************
+	* Modifiers
+	**********************/
+	StringPool::Id StringPool::intern(StringView text) {
+		auto itr = _ids.find(text);
+		if (itr != _ids.cend()) {
+			return itr->second;
+		}
+
+		// start a new block when the string doesn't fit, oversized strings get a block of their own
+		if (_blocks.empty() || _blockCapacity - _blockUsed < text.size()) {
+			_blockCapacity = std::max(BLOCK_SIZE, text.size());
+			_blocks.emplace_back(new char[_blockCapacity]);
+			_blockUsed = 0;
+		}
+
+		char * storage = _blocks.back().get() + _blockUsed;
+		if (!text.empty()) {
+			std::memcpy(storage, text.data(), text.size());
+		}
+		_blockUsed += text.size();
+		_bytes     += text.size();
+
+		const Id id = static_cast<Id>(_strings.size());
+		_strings.emplace_back(storage, text.size());
+		_ids.emplace(_strings.back(), id);
+		return id;
+	}
+}
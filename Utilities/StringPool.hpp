@@ -0,0 +1,69 @@
+/**
+ * File: StringPool.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: This file is the interface to the StringPool class, a dictionary of
+ *				interned strings.  Each distinct string is stored once, in large blocks
+ *				of memory that never move, and is identified by a small integer Id.
+ **/
+
+#ifndef UTILITIES_StringPool_hpp
+#define UTILITIES_StringPool_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/StringView.hpp"
+
+
+
+
+namespace Utilities
+{
+  class StringPool
+  {
+    public:
+      using Id = std::uint32_t;     // Ids are assigned consecutively from 0 in the order strings are first interned
+
+
+      // Constructors and Destructor
+      StringPool             (                     )          = default;
+      StringPool             ( const StringPool &  );                     // copies keep the same Ids
+      StringPool             (       StringPool && ) noexcept;            // leaves the other pool empty and usable
+      StringPool & operator= ( const StringPool &  );
+      StringPool & operator= (       StringPool && ) noexcept;
+     ~StringPool             (                     ) noexcept = default;
+
+
+      // Queries
+      StringView    operator[] ( Id id     ) const noexcept;     // the id must have been returned by intern()
+      bool          find       ( StringView text, Id & id ) const;
+      std::size_t   size       (           ) const noexcept;   // number of distinct strings
+      std::size_t   bytes      (           ) const noexcept;   // characters stored
+
+
+      // Modifiers
+      Id            intern     ( StringView text );            // returns the Id of text, adding it if it is new
+
+
+
+
+    private:
+      // Instance attribute (aka object state attributes)
+      std::vector<std::unique_ptr<char[]>>   _blocks;                // string storage, views into it stay valid as the pool grows
+      std::size_t                            _blockUsed     = 0;     // characters used in the last block
+      std::size_t                            _blockCapacity = 0;     // characters available in the last block
+      std::size_t                            _bytes         = 0;
+      std::vector<StringView>                _strings;               // indexed by Id
+      std::unordered_map<StringView, Id>     _ids;
+
+
+      // Class attributes
+      static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+  };  // class StringPool
+} // namespace Utilities
+#endif
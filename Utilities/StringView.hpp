@@ -0,0 +1,31 @@
+/**
+ * File: StringView.hpp
+ * Author: Ryan Johnson
+ * Email: johnsonrw82@csu.fullerton.edu
+ *
+ * Description: Utilities::StringView is std::string_view when compiling for C++17, and the
+ *				Library Fundamentals TS version (std::experimental::string_view) otherwise, so
+ *				the project keeps building with -std=c++14.
+ **/
+
+#ifndef UTILITIES_StringView_hpp
+#define UTILITIES_StringView_hpp
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+  #include <string_view>
+#else
+  #include <experimental/string_view>
+#endif
+
+
+
+
+namespace Utilities
+{
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+  using StringView = std::string_view;
+#else
+  using StringView = std::experimental::string_view;
+#endif
+} // namespace Utilities
+#endif
@@ -23,18 +23,97 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
+#include <fstream>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <new>
+#include <numeric>
+#include <random>
+#include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include "Addresses/Address.hpp"
+#include "Addresses/AddressFilter.hpp"
+#include "Addresses/AddressTable.hpp"
+#include "Addresses/AddressValidation.hpp"
+#include "Addresses/Collation.hpp"
+#include "Addresses/Deduplicator.hpp"
+#include "Addresses/ExternalSort.hpp"
+#include "Addresses/Presort.hpp"
+#include "Addresses/States.hpp"
+#include "Addresses/ZipCode.hpp"
+#include "Addresses/ZipIndex.hpp"
 #include "Companies/Company.hpp"
+#include "Companies/NameIndex.hpp"
+#include "Employees/Directory.hpp"
 #include "Employees/Employee.hpp"
+#include "Employees/Names.hpp"
+#include "MailSystem/ConcurrentRegistry.hpp"
+#include "MailSystem/Registry.hpp"
+#include "Utilities/Binary.hpp"
+#include "Utilities/BloomFilter.hpp"
 #include "Utilities/Exceptions.hpp"
+#include "Utilities/LoserTree.hpp"
+#include "Utilities/ParallelLoader.hpp"
+#include "Utilities/Postings.hpp"
+#include "Utilities/RecordFramer.hpp"
+#include "Utilities/RecordFile.hpp"
+
+
+
+/****************************************************************************
+** The global allocation functions are replaced so tests can count heap
+** allocations (see runMoveSemanticsTest)
+****************************************************************************/
+namespace
+{
+  std::atomic<std::size_t> allocations{ 0 };
+
+  // Out of line so the compiler doesn't see std::free() freeing what it thinks operator new (not std::malloc) returned
+#if defined(__GNUC__)
+  __attribute__((noinline))
+#endif
+  void release( void * memory ) noexcept  { std::free( memory ); }
+}
+
+// Every form that allocates counts and every form that frees calls release(), so memory from any new may reach any delete
+// (the library's own code mixes them, e.g. std::stable_sort's nothrow buffer).
+void * operator new( std::size_t size, const std::nothrow_t & ) noexcept
+{
+  ++allocations;
+  return std::malloc( size == 0 ? 1 : size );
+}
+
+void * operator new( std::size_t size )
+{
+  if( void * memory = operator new( size, std::nothrow ) )  return memory;
+  throw std::bad_alloc();
+}
+
+void * operator new[]( std::size_t size )                                    { return operator new( size ); }
+void * operator new[]( std::size_t size, const std::nothrow_t & ) noexcept   { return operator new( size, std::nothrow ); }
+
+void operator delete  ( void * memory ) noexcept                             { release( memory ); }
+void operator delete  ( void * memory, std::size_t ) noexcept                { release( memory ); }
+void operator delete  ( void * memory, const std::nothrow_t & ) noexcept     { release( memory ); }
+void operator delete[]( void * memory ) noexcept                             { release( memory ); }
+void operator delete[]( void * memory, std::size_t ) noexcept                { release( memory ); }
+void operator delete[]( void * memory, const std::nothrow_t & ) noexcept     { release( memory ); }
 
 
 
@@ -140,6 +219,31 @@ namespace // unnamed, anonymous namespace for internal (local) linkage
 		throw PropertyValueException(ex, "The state name is valid", __LINE__, __func__, __FILE__);
 	}
 
+	// verify every state code and name in the state table, in both cases
+	for (States::Ordinal state = 1; state <= States::COUNT; ++state) {
+		std::string name = States::name(state);
+		std::string code = States::code(state);
+		std::transform(code.begin(), code.end(), code.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+
+		if (properties[2].state(code).state() != name || properties[2].state(name).state() != name) {
+			throw PropertyValueException("State table lookup failed", __LINE__, __func__, __FILE__);
+		}
+
+		std::transform(name.begin(), name.end(), name.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+		if (properties[2].state(name).state() != States::name(state)) {
+			throw PropertyValueException("State table lookup failed", __LINE__, __func__, __FILE__);
+		}
+	}
+
+	// names that only differ from a real state name in length or by a non-letter must not be found
+	for (const auto & bad : { "", "W", "Ohi", "Ohioo", "New  York", "New_York" }) {
+		try {
+			properties[2].state(bad);
+			throw UndetectedException("Undetected Wrong State or State Code", __LINE__, __func__, __FILE__);
+		}
+		catch (Address::StateCodeException &) {}
+	}
+
     // verify zip codes
 	// valid
 	try {
@@ -195,6 +299,25 @@ namespace // unnamed, anonymous namespace for internal (local) linkage
 	}
 	catch (Address::ZipCodeException &) {} // catch and ignore expected exception type, let all other propagate up
 
+	// verify the compact state and zip code forms read back as the same strings
+	{
+		const Address plus4("1313 S. Harbor Boulevard", "Anaheim", "ca", "92803-1313");
+		const Address zip5 ("1313 S. Harbor Boulevard", "Anaheim", "California", "92803");
+
+		if (plus4.state() != "California" || plus4.zipCode() != "92803-1313" || zip5.zipCode() != "92803" ||
+			plus4.stateOrdinal() != zip5.stateOrdinal() || ZipCode::zip5(plus4.packedZipCode()) != 92803) {
+			throw PropertyValueException("Compact state or zip code not stored properly", __LINE__, __func__, __FILE__);
+		}
+		if (Address().state() != "" || Address().zipCode() != "") {
+			throw PropertyValueException("Default state and zip code should be empty", __LINE__, __func__, __FILE__);
+		}
+
+		// only the first 5 digits of the zip code take part in comparisons
+		if (plus4 != zip5 || plus4 < zip5 || !(plus4 <= zip5)) {
+			throw RelationalTestFailure("Equality Failure", __LINE__, __func__, __FILE__);
+		}
+	}
+
     // verify some equality checks
     if( properties[0] != properties[0] )  throw RelationalTestFailure( "Equality Failure", __LINE__, __func__, __FILE__ );
 	if( properties[1] == properties[0] ) throw RelationalTestFailure("Equality Failure", __LINE__, __func__, __FILE__);
@@ -255,6 +378,199 @@ namespace // unnamed, anonymous namespace for internal (local) linkage
 
 
 
+  /****************************************************************************
+  ** Zip Code Verification & Regression Test
+  **
+  ** The zip code validator must give exactly the same answers as the regular
+  ** expression it replaced.
+  ****************************************************************************/
+  void runZipCodeTest()
+  {
+    using namespace Addresses;
+
+    const std::regex         zipRegex( R"/((?!0{5})(?!9{5})\d{5}(-(?!0{4})(?!9{4})\d{4})?)/" );
+    std::vector<std::string> tested;  // everything that fits in a batch slot, for the batch validation checks below
+
+    auto verify = [&zipRegex, &tested]( const std::string & code )
+    {
+      if( code.length() <= ZipCode::SLOT_SIZE )  tested.push_back( code );
+
+      const bool expected = std::regex_match( code, zipRegex );
+      if( ZipCode::isValid( code.data(), code.length() ) != expected )
+      {
+        throw RegressionTestException( "Zip code validator disagrees with regex for \"" + code + '"', __LINE__, __func__, __FILE__ );
+      }
+
+      // valid codes must survive a round trip through the packed form
+      char buffer[ZipCode::MAX_LENGTH];
+      if( expected  &&  std::string( buffer, ZipCode::format( ZipCode::parse( code.data(), code.length() ), buffer ) ) != code )
+      {
+        throw RegressionTestException( "Zip code round trip failed for \"" + code + '"', __LINE__, __func__, __FILE__ );
+      }
+    };
+
+    // every 5 digit code, as text and as a number
+    for( unsigned long zip = 0; zip <= 99999; ++zip )
+    {
+      std::string code = std::to_string( zip );
+      code.insert( 0, 5 - code.length(), '0' );
+      verify( code );
+
+      if( ZipCode::isValid( zip ) != ZipCode::isValid( code.data(), code.length() ) )
+      {
+        throw RegressionTestException( "Numeric zip code validation failed for " + code, __LINE__, __func__, __FILE__ );
+      }
+    }
+    if( ZipCode::isValid( 100000UL ) || ZipCode::isValid( 123456789UL ) )
+    {
+      throw UndetectedException( "Undetected Wrong Zip Code", __LINE__, __func__, __FILE__ );
+    }
+
+    // edge cases around the +4
+    for( const auto & code : { "12345-0001", "12345-9998", "12345-0000", "12345-9999", "00001-1234", "99998-1234",
+                               "12345-", "12345-123", "12345 1234", "12345-1234 ", "1234-12345", "", "-" } )
+    {
+      verify( code );
+    }
+
+    // random strings drawn mostly from the characters that matter
+    std::mt19937                          random( 20150612 );
+    std::uniform_int_distribution<size_t> pickLength( 0, 11 );
+    const std::string                     alphabet( "0123456789990000--a /:" );
+    std::uniform_int_distribution<size_t> pickCharacter( 0, alphabet.size() - 1 );
+    for( int i = 0; i < 100000; ++i )
+    {
+      std::string code( pickLength( random ), ' ' );
+      for( auto & c : code )  c = alphabet[pickCharacter( random )];
+      if( code.length() > 5 && i % 2 == 0 )  code[5] = '-';
+      verify( code );
+    }
+
+    // batch validation must give the same answers with every instruction set, including for the slots in a partial block at the end
+    for( std::size_t count : { tested.size(), std::size_t{ 13 }, std::size_t{ 5 }, std::size_t{ 0 } } )
+    {
+      std::string slots;
+      for( std::size_t i = 0; i < count; ++i )  slots += tested[i] + std::string( ZipCode::SLOT_SIZE - tested[i].length(), '\0' );
+
+      for( auto isa : { Utilities::Simd::Isa::SCALAR, Utilities::Simd::Isa::SSE2, Utilities::Simd::Isa::AVX2 } )
+      {
+        std::vector<std::uint8_t>    valid( ( count + 7 ) / 8 );
+        std::vector<ZipCode::Packed> zips ( count );
+        std::size_t                  validCount = ZipCode::validate( slots.data(), count, valid.data(), zips.data(), isa );
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+          const auto expected = ZipCode::parse( tested[i].data(), tested[i].length() );
+          const bool isValid  = ( valid[i / 8] >> ( i % 8 ) ) & 1;
+          if( isValid != ( expected != ZipCode::NONE )  ||  zips[i] != expected )
+          {
+            throw RegressionTestException( "Batch zip code validation disagrees for \"" + tested[i] + '"', __LINE__, __func__, __FILE__ );
+          }
+          validCount -= isValid;
+        }
+        if( validCount != 0 )  throw RegressionTestException( "Batch zip code validation miscounted", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // a 5 digit zip code must be followed by nothing but padding
+    {
+      const char      slot[] = "12345\0\0\0\0x";
+      std::uint8_t    valid  = 0xFF;
+      ZipCode::Packed zip    = 0;
+      if( ZipCode::validate( slot, 1, &valid, &zip ) != 0  ||  valid != 0  ||  zip != ZipCode::NONE )
+      {
+        throw UndetectedException( "Undetected Wrong Zip Code", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runZipCodeTest()
+
+
+
+
+  /****************************************************************************
+  ** Address Table Verification & Regression Test
+  ****************************************************************************/
+  void runAddressTableTest()
+  {
+    using namespace Addresses;
+
+    const std::vector<Address> properties =
+    {
+      {"157 S. Howard Street", "Spokane", "WA", 99201UL},
+      {"1014 Vine Street", "Cincinnati", "Ohio", "45202-1100"},
+      {"1313 S. Harbor Boulevard", "Anaheim", "CA", "92803-1313"},
+      {"8039 Beach Boulevard", "Buena Park", "CA", 90620UL},
+      {"1 Disneyland Drive", "Anaheim", "CA", "92802"},
+      {"500 Newport Center Drive", "Newport Beach", "CA", "92660"},
+      {"3333 Bristol Street", "Costa Mesa", "CA", "92626-1810"},
+      {"Spectrum Center Drive", "Irvine", "CA", "92618"},
+      {"1 Bluff Road", "Newport", "Rhode Island", "02840"},
+      {}
+    };
+
+    AddressTable table( properties );
+    table.append( properties[2] );
+
+    // rows read back as the same addresses
+    if( table.size() != properties.size() + 1 )  throw RegressionTestException( "Address table size is wrong", __LINE__, __func__, __FILE__ );
+    for( std::size_t row = 0; row < properties.size(); ++row )
+    {
+      const Address address = table.address( row );
+      if( address != properties[row]  ||  address.zipCode() != properties[row].zipCode()  ||  address.state() != properties[row].state() )
+      {
+        throw SemmetricalIOFailure( "Address table row does not match the address appended", __LINE__, __func__, __FILE__ );
+      }
+    }
+    if( table[2].street() != "1313 S. Harbor Boulevard"  ||  table[2].state() != "California"  ||  table[2].zipCode() != "92803-1313" )
+    {
+      throw PropertyValueException( "Address table row view is wrong", __LINE__, __func__, __FILE__ );
+    }
+
+    // repeated strings are stored once
+    if( table.cityIds()[2] != table.cityIds()[4]  ||  table.streetIds()[2] != table.streetIds()[10]  ||  table.strings().size() != 18 )
+    {
+      throw PropertyValueException( "Address table strings were not interned", __LINE__, __func__, __FILE__ );
+    }
+
+    // scans
+    const auto california = States::fromCode( "CA", 2 );
+    if( table.select( california, "926" )                      != std::vector<AddressTable::RowId>{ 5, 6, 7 }
+     || table.select( california, "928" )                      != std::vector<AddressTable::RowId>{ 2, 4, 10 }
+     || table.select( States::NONE, "0" )                      != std::vector<AddressTable::RowId>{ 8 }
+     || table.select( States::fromName( "Ohio", 4 ), "45202" ) != std::vector<AddressTable::RowId>{ 1 }
+     || table.select( california ).size()                      != 7
+     || !table.select( california, "9X" ).empty()
+     || !table.select( california, "926183" ).empty() )
+    {
+      throw RegressionTestException( "Address table scan returned the wrong rows", __LINE__, __func__, __FILE__ );
+    }
+
+    // copies are independent of the original
+    AddressTable copy( table );
+    table.clear();
+    if( !table.empty()  ||  copy.addresses().back() != properties[2]  ||  copy[8].city() != "Newport" )
+    {
+      throw RegressionTestException( "Address table copy failed", __LINE__, __func__, __FILE__ );
+    }
+
+    // a moved-from table can be appended to again
+    AddressTable moved( std::move( copy ) );
+    copy.append( properties[0] );
+    copy.append( properties[8] );
+    if( copy.size() != 2  ||  copy.address( 0 ) != properties[0]  ||  copy[1].city() != "Newport"  ||  copy.strings().size() != 4
+     || moved.size() != properties.size() + 1  ||  moved[8].city() != "Newport" )
+    {
+      throw RegressionTestException( "Moved-from address table is not reusable", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runAddressTableTest()
+
+
+
+
   /****************************************************************************
   ** Company Verification & Regression Test
   ****************************************************************************/
@@ -455,21 +771,1980 @@ namespace // unnamed, anonymous namespace for internal (local) linkage
     std::cout << "Success:  " << __func__ << "\v\n";
   }  //  void runEmployeeTest() 
 
-}// unnamed, anonymous namespace
 
-int main()
-{
-  try
+
+  /****************************************************************************
+  ** Record File (Bulk Loader) Verification & Regression Test
+  **
+  ** Records loaded through the memory mapped file must match the ones read
+  ** back through the extraction operators.
+  ****************************************************************************/
+  void runRecordFileTest()
   {
-    const auto seperator = std::string( 80, '=' );
-	
-    ::runAddressTest();
-    std::cout << seperator << '\n';
+    const std::string path = "runRecordFileTest.tmp";
 
-    ::runCompanyTest();
-    std::cout << seperator << '\n';
+    // writes the records to the test file with the insertion operator
+    auto writeFile = [&path]( const auto & records, const std::string & trailer )
+    {
+      std::ofstream file( path, std::ios::binary | std::ios::trunc );
+      for( const auto & record : records )  file << record;
+      file << trailer;
+    };
 
-    ::runEmployeeTest();
+    // loads the test file both ways and compares
+    auto verify = [&path]( const auto & records )
+    {
+      using Record = typename std::decay_t<decltype( records )>::value_type;
+
+      Utilities::RecordFile file( path );
+      if( file.size() != records.size() )  throw SemmetricalIOFailure( "Record count mismatch", __LINE__, __func__, __FILE__ );
+
+      const auto loaded = file.loadAll<Record>();
+      std::ifstream stream( path, std::ios::binary );
+      for( std::size_t i = 0; i < records.size(); ++i )
+      {
+        Record extracted;
+        stream >> extracted;
+        if( loaded[i] != records[i]  ||  extracted != records[i]  ||  file.load<Record>( i ) != records[i] )
+        {
+          throw SemmetricalIOFailure( "Bulk loaded record does not match", __LINE__, __func__, __FILE__ );
+        }
+      }
+    };
+
+    {
+      const std::vector<Addresses::Address> addresses =
+      {
+        {"157 S. Howard Street", "Spokane", "WA", 99201UL},
+        {"1014 Vine Street", "Cincinnati", "Ohio", "45202-1100"},
+        {"1313 S. Harbor Boulevard", "Anaheim", "CA", "92803-1313"}
+      };
+      writeFile( addresses, "" );
+      verify( addresses );
+
+      // fields are views into the file
+      Utilities::RecordFile file( path );
+      const auto fields = file.fields( 1 );
+      if( fields.count != 4  ||  fields.field[0] != "1014 Vine Street"  ||  fields.field[3] != "45202-1100" )
+      {
+        throw PropertyValueException( "Record fields not split properly", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    {
+      const std::vector<Companies::Company> companies = { {"The Kroger Co"}, {"Albertson's, Inc"}, {"CSUF UEE"} };
+      writeFile( companies, "" );
+      verify( companies );
+    }
+
+    {
+      const std::vector<Employees::Employee> workers = { {"Tom", "Bettens"}, {"Disney, Walt"}, {"Skywalker"}, {"Holmes, Sherlock"} };
+      writeFile( workers, "" );
+      verify( workers );
+
+      // a last record without a record separator is still a record, in both "last, first" and separate field forms
+      writeFile( workers, "Stroustrup, Bjarne" );
+      Utilities::RecordFile file( path );
+      if( file.size() != workers.size() + 1  ||  file.load<Employees::Employee>( workers.size() ) != Employees::Employee( "Bjarne", "Stroustrup" ) )
+      {
+        throw SemmetricalIOFailure( "Unterminated last record not loaded", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // records holding nothing are counted but not loaded
+    {
+      std::ofstream( path, std::ios::binary | std::ios::trunc ) << "\x04" << Companies::Company( "CSUF UEE" ) << "\x04";
+      Utilities::RecordFile file( path );
+      const auto loaded = file.loadAll<Companies::Company>();
+      if( file.size() != 3  ||  loaded.size() != 1  ||  loaded[0] != Companies::Company( "CSUF UEE" ) )
+      {
+        throw SemmetricalIOFailure( "Empty records loaded", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // invalid records are only rejected when they are materialized
+    {
+      std::ofstream( path, std::ios::binary | std::ios::trunc ) << "1 Main Street\x03Springfield\x03XX\x03" << "12345\x04";
+      Utilities::RecordFile file( path );
+      if( file.size() != 1 )  throw SemmetricalIOFailure( "Record count mismatch", __LINE__, __func__, __FILE__ );
+      try
+      {
+        file.load<Addresses::Address>( 0 );
+        throw UndetectedException( "Undetected Wrong State or State Code", __LINE__, __func__, __FILE__ );
+      }
+      catch( Addresses::Address::StateCodeException & ) {}
+    }
+
+    // empty and missing files
+    {
+      std::ofstream( path, std::ios::binary | std::ios::trunc );
+      if( Utilities::RecordFile( path ).size() != 0 )  throw SemmetricalIOFailure( "Empty file has records", __LINE__, __func__, __FILE__ );
+    }
+    std::remove( path.c_str() );
+    try
+    {
+      Utilities::RecordFile file( path );
+      throw UndetectedException( "Undetected missing file", __LINE__, __func__, __FILE__ );
+    }
+    catch( Utilities::MappedFile::MappedFileExceptions & ) {}
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runRecordFileTest()
+
+
+  /****************************************************************************
+  ** Record Framer Verification & Regression Test
+  **
+  ** Every instruction set must frame records and fields exactly as
+  ** std::getline() and Records::split() do.
+  ****************************************************************************/
+  void runRecordFramerTest()
+  {
+    using namespace Utilities;
+
+    std::mt19937 random( 20150612 );
+    const std::string alphabet( "abcdefgh \x03\x03\x04" );
+    std::uniform_int_distribution<std::size_t> pickCharacter( 0, alphabet.size() - 1 );
+
+    // short texts hit the scalar tails, the long one crosses several framing chunks
+    for( std::size_t length : { 0, 1, 15, 16, 17, 31, 32, 33, 100, 1000, 600000 } )
+    {
+      std::string text( length, ' ' );
+      for( auto & c : text )  c = alphabet[pickCharacter( random )];
+
+      // the reference:  records from std::getline, fields from split()
+      std::vector<std::string>     records;
+      std::vector<Records::Fields> expected;
+      {
+        std::istringstream stream( text );
+        std::string        record;
+        while( std::getline( stream, record, Records::RECORD_SEPARATOR ) )  records.push_back( record );
+        for( const auto & r : records )  expected.push_back( Records::split( r ) );
+      }
+
+      for( auto isa : { Simd::Isa::SCALAR, Simd::Isa::SSE2, Simd::Isa::AVX2 } )
+      {
+        std::size_t count = 0;
+        Records::forEachRecord( text, [&]( StringView record, const Records::Fields & fields )
+        {
+          if( count >= records.size()  ||  record != records[count]  ||  fields.count != expected[count].count )
+          {
+            throw RegressionTestException( "Record framing does not match std::getline", __LINE__, __func__, __FILE__ );
+          }
+          for( std::size_t f = 0; f < Records::MAX_FIELDS; ++f )
+          {
+            if( fields.field[f] != expected[count].field[f] )  throw RegressionTestException( "Field framing does not match split()", __LINE__, __func__, __FILE__ );
+          }
+          ++count;
+        }, isa );
+        if( count != records.size() )  throw RegressionTestException( "Record framing missed records", __LINE__, __func__, __FILE__ );
+
+        // the offset index itself
+        if( length <= 1000 )
+        {
+          std::vector<std::uint32_t> offsets( length );
+          const std::size_t found = Records::findSeparators( text.data(), text.size(), offsets.data(), isa );
+          std::size_t next = 0;
+          for( std::size_t i = 0; i < text.size(); ++i )
+          {
+            if( text[i] != Records::FIELD_SEPARATOR  &&  text[i] != Records::RECORD_SEPARATOR )  continue;
+            if( next >= found  ||  offsets[next++] != i )  throw RegressionTestException( "Separator offset index is wrong", __LINE__, __func__, __FILE__ );
+          }
+          if( next != found )  throw RegressionTestException( "Separator offset index is wrong", __LINE__, __func__, __FILE__ );
+        }
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runRecordFramerTest()
+
+  /****************************************************************************
+  ** Parallel Loader Verification & Regression Test
+  ****************************************************************************/
+  void runParallelLoaderTest()
+  {
+    using Addresses::Address;
+
+    const std::string path = "runParallelLoaderTest.tmp";
+
+    // enough records that every thread gets several shards
+    std::vector<Address> addresses;
+    {
+      const char * states[] = { "CA", "Ohio", "WA", "texas", "NY" };
+      std::ofstream file( path, std::ios::binary | std::ios::trunc );
+      for( unsigned long i = 0; i < 20000; ++i )
+      {
+        addresses.emplace_back( std::to_string( i ) + " Main Street", "City " + std::to_string( i % 97 ), states[i % 5], 10000 + i );
+        file << addresses.back();
+        if( i % 1000 == 0 )  file << '\x04';   // a record holding nothing, left out
+      }
+    }
+
+    // shards never split a record
+    {
+      const std::string text = "a\x04" "bb\x04" "ccc\x04" "dddd";
+      const auto shards = Utilities::shardRecords( text, 3 );
+      std::string joined;
+      for( const auto & shard : shards )
+      {
+        if( shard.empty()  ||  ( &shard != &shards.back()  &&  shard.back() != '\x04' ) )
+        {
+          throw RegressionTestException( "Shard does not end at a record boundary", __LINE__, __func__, __FILE__ );
+        }
+        joined.append( shard.data(), shard.size() );
+      }
+      if( joined != text  ||  shards.size() != 3  ||  !Utilities::shardRecords( "", 4 ).empty() )
+      {
+        throw RegressionTestException( "Shards do not cover the text", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // records come back complete and in file order, whatever the number of threads
+    for( std::size_t threads : { 1, 2, 3, 8, 64 } )
+    {
+      if( Utilities::loadParallel<Address>( path, threads ) != addresses )
+      {
+        throw SemmetricalIOFailure( "Parallel load does not match the records written", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // the exception for the first bad record in the file is the one reported
+    {
+      std::ofstream file( path, std::ios::binary | std::ios::app );
+      file << "1 Main Street\x03Springfield\x03XX\x03" "12345\x04";
+      for( std::size_t i = 0; i < 1000; ++i )  file << addresses[i];
+      file << "1 Main Street\x03Springfield\x03OH\x03" "00000\x04";
+    }
+    try
+    {
+      Utilities::loadParallel<Address>( path, 8 );
+      throw UndetectedException( "Undetected Wrong State or State Code", __LINE__, __func__, __FILE__ );
+    }
+    catch( Address::StateCodeException & ) {}
+
+    std::remove( path.c_str() );
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runParallelLoaderTest()
+
+
+  /****************************************************************************
+  ** Binary Format Verification & Regression Test
+  **
+  ** Records extracted from text, serialized and deserialized must insert the
+  ** same text again, and damaged binary data must be detected.
+  ****************************************************************************/
+  void runBinaryFormatTest()
+  {
+    using Addresses::Address;
+    using Companies::Company;
+    using Employees::Employee;
+    using namespace Utilities::Binary;
+
+    const std::vector<Address>  addresses = { {"157 S. Howard Street", "Spokane", "WA", 99201UL},
+                                              {"1014 Vine Street", "Cincinnati", "Ohio", "45202-1100"},
+                                              {"", "", "CA", "00501"} };
+    const std::vector<Company>  companies = { {"The Kroger Co"}, {"Albertson's, Inc"}, {std::string( 300, 'x' )} };  // long enough for a 2 byte length
+    const std::vector<Employee> workers   = { {"Bjarne", "Stroustrup"}, {"Lovelace, Ada"}, {"", ""} };
+
+    // symmetric text -> binary -> text, every record type in one buffer
+    {
+      std::stringstream text;
+      for( const auto & address  : addresses )  text << address;
+      for( const auto & company  : companies )  text << company;
+      for( const auto & employee : workers   )  text << employee;
+      const std::string original = text.str();
+
+      Buffer buffer;
+      for( std::size_t i = 0; i < addresses.size(); ++i )  { Address  temp;  text >> temp;  temp.serialize( buffer ); }
+      for( std::size_t i = 0; i < companies.size(); ++i )  { Company  temp;  text >> temp;  temp.serialize( buffer ); }
+      for( std::size_t i = 0; i < workers  .size(); ++i )  { Employee temp;  text >> temp;  temp.serialize( buffer ); }
+
+      for( bool trusted : { false, true } )
+      {
+        Reader             reader( buffer.view(), trusted );
+        std::ostringstream result;
+        for( const auto & address : addresses )
+        {
+          Address temp;
+          result << temp.deserialize( reader );
+          if( temp != address  ||  temp.zipCode() != address.zipCode() )  throw SemmetricalIOFailure( "Binary round trip failure", __LINE__, __func__, __FILE__ );
+        }
+        for( const auto & company : companies )
+        {
+          Company temp;
+          result << temp.deserialize( reader );
+          if( temp != company )  throw SemmetricalIOFailure( "Binary round trip failure", __LINE__, __func__, __FILE__ );
+        }
+        for( const auto & employee : workers )
+        {
+          Employee temp;
+          result << temp.deserialize( reader );
+          if( temp != employee )  throw SemmetricalIOFailure( "Binary round trip failure", __LINE__, __func__, __FILE__ );
+        }
+
+        if( !reader.atEnd()  ||  result.str() != original )  throw SemmetricalIOFailure( "Binary round trip failure", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // default constructed objects have no state or zip code, which is allowed in the binary form
+    {
+      Buffer buffer;
+      Address().serialize( buffer );
+      Company().serialize( buffer );
+
+      Address address = addresses[0];
+      Company company = companies[0];
+      Reader  reader( buffer.view() );
+      address.deserialize( reader );
+      company.deserialize( reader );
+      if( address != Address()  ||  address.zipCode() != ""  ||  company != Company()  ||  !reader.atEnd() )
+      {
+        throw SemmetricalIOFailure( "Binary round trip failure", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // fields a later version appends to a payload are skipped
+    {
+      Buffer buffer;
+      const std::size_t record = buffer.beginRecord( RecordType::COMPANY );
+      buffer.putString( "Extended" ).put32( 42 );
+      buffer.endRecord( record );
+      companies[0].serialize( buffer );
+
+      Company first;
+      Company second;
+      Reader  reader( buffer.view() );
+      first.deserialize( reader );
+      second.deserialize( reader );
+      if( first.name() != "Extended"  ||  second != companies[0]  ||  !reader.atEnd() )
+      {
+        throw PropertyValueException( "Unread payload fields not skipped", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // damaged records throw and leave the object unchanged
+    {
+      Buffer buffer;
+      addresses[1].serialize( buffer );
+      const std::string bytes( buffer.data(), buffer.size() );
+
+      auto expectThrow = [&addresses]( const auto & exception, const std::string & damaged )
+      {
+        Address temp = addresses[0];
+        try
+        {
+          Reader reader( Utilities::StringView( damaged.data(), damaged.size() ) );
+          temp.deserialize( reader );
+          throw UndetectedException( "Undetected damaged binary record", __LINE__, __func__, __FILE__ );
+        }
+        catch( const std::decay_t<decltype( exception )> & ) {}
+
+        if( temp != addresses[0]  ||  temp.zipCode() != addresses[0].zipCode() )
+        {
+          throw PropertyValueException( "Failed deserialize changed the address", __LINE__, __func__, __FILE__ );
+        }
+      };
+
+      // every truncation
+      for( std::size_t length = 0; length < bytes.size(); ++length )  expectThrow( FormatException( "", 0, "", "" ), bytes.substr( 0, length ) );
+
+      std::string damaged = bytes;
+      damaged[0] = static_cast<char>( RecordType::EMPLOYEE );
+      expectThrow( FormatException( "", 0, "", "" ), damaged );
+
+      damaged = bytes;
+      damaged[1] = VERSION + 1;
+      expectThrow( VersionException( "", 0, "", "" ), damaged );
+
+      damaged = bytes;
+      damaged[HEADER_SIZE] = static_cast<char>( Addresses::States::COUNT + 1 );
+      expectThrow( Address::StateCodeException( "", 0, "", "" ), damaged );
+
+      damaged = bytes;
+      damaged[HEADER_SIZE + 4] = '\x7F';                                     // zip5 > 99999
+      expectThrow( Address::ZipCodeException( "", 0, "", "" ), damaged );
+
+      // a string length past the end of the record
+      Buffer lengths;
+      const std::size_t record = lengths.beginRecord( RecordType::COMPANY );
+      lengths.putVarint( 1000 );
+      lengths.endRecord( record );
+      Company company;
+      Reader  reader( lengths.view() );
+      try
+      {
+        company.deserialize( reader );
+        throw UndetectedException( "Undetected string longer than its record", __LINE__, __func__, __FILE__ );
+      }
+      catch( FormatException & ) {}
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runBinaryFormatTest()
+
+
+  /****************************************************************************
+  ** Non-throwing Address Validation Verification & Regression Test
+  ****************************************************************************/
+  void runAddressValidationTest()
+  {
+    using Addresses::Address;
+    using Error = Address::Error;
+
+    // each rule reports its own error and leaves the address alone
+    {
+      const Address original( "1014 Vine Street", "Cincinnati", "Ohio", "45202-1100" );
+
+      struct { const char * state; const char * zip; Error expected; } cases[] =
+      {
+        { "CA",         "92803-1313", Error::NONE               },
+        { "ca",         "92803",      Error::NONE               },
+        { "XX",         "92803",      Error::STATE_ABBREVIATION },
+        { "Calif",      "92803",      Error::STATE_NAME         },
+        { "",           "92803",      Error::STATE_NAME         },
+        { "CA",         "00000",      Error::ZIP_CODE           },
+        { "CA",         "92803-",     Error::ZIP_CODE           },
+        { "CA",         "",           Error::ZIP_CODE           },
+        { "XX",         "00000",      Error::STATE_ABBREVIATION }   // state is checked first, like the constructors
+      };
+
+      for( const auto & test : cases )
+      {
+        Address address = original;
+        if( Address::tryMake( "1313 S. Harbor Boulevard", "Anaheim", test.state, test.zip, address ) != test.expected )
+        {
+          throw PropertyValueException( std::string( "Wrong error for " ) + test.state + ", " + test.zip, __LINE__, __func__, __FILE__ );
+        }
+
+        const bool unchanged = address == original  &&  address.zipCode() == original.zipCode();
+        if( ( test.expected == Error::NONE ) == unchanged )  throw PropertyValueException( "tryMake changed the wrong address", __LINE__, __func__, __FILE__ );
+
+        // the throwing constructor agrees, and throws the matching exception type
+        try
+        {
+          Address( "1313 S. Harbor Boulevard", "Anaheim", test.state, test.zip );
+          if( test.expected != Error::NONE )  throw UndetectedException( "Constructor did not throw", __LINE__, __func__, __FILE__ );
+        }
+        catch( Address::StateCodeException & ) { if( test.expected != Error::STATE_ABBREVIATION  &&  test.expected != Error::STATE_NAME ) throw; }
+        catch( Address::ZipCodeException   & ) { if( test.expected != Error::ZIP_CODE ) throw; }
+      }
+
+      Address address = original;
+      if( address.tryZipCode( 123456UL ) != Error::ZIP_CODE_VALUE  ||  address.tryState( "Nowhere" ) != Error::STATE_NAME  ||  address.zipCode() != original.zipCode() )
+      {
+        throw PropertyValueException( "Non-throwing modifier failure", __LINE__, __func__, __FILE__ );
+      }
+      if( address.tryZipCode( 501UL ) != Error::NONE  ||  address.tryState( "wa" ) != Error::NONE  ||  address.zipCode() != "00501"  ||  address.state() != "Washington" )
+      {
+        throw PropertyValueException( "Non-throwing modifier failure", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // batch validation reports every bad record and keeps the good ones
+    {
+      const std::vector<Address> good = { {"157 S. Howard Street", "Spokane", "WA", 99201UL},
+                                          {"1014 Vine Street", "Cincinnati", "Ohio", "45202-1100"},
+                                          {"1313 S. Harbor Boulevard", "Anaheim", "CA", "92803-1313"} };
+      std::ostringstream text;
+      text << good[0]
+           << "1 Main Street\x03Springfield\x03XX\x03" "12345\x04"
+           << good[1]
+           << "1 Main Street\x03Springfield\x03OH\x03" "99999\x04"
+           << "\x04"                                                         // blank records are skipped, not rejected
+           << "1 Main Street\x03Springfield\x03Nowhere\x03" "12345\x04"
+           << good[2];
+      const std::string records = text.str();
+
+      std::vector<Address> valid;
+      const auto report = Addresses::validateRecords( records, &valid );
+
+      if( report.records != 6  ||  report.valid() != 3  ||  valid != good  ||  report.rejections.size() != 3
+      ||  report.rejections[0].record != 1  ||  report.rejections[0].error != Error::STATE_ABBREVIATION
+      ||  report.rejections[1].record != 3  ||  report.rejections[1].error != Error::ZIP_CODE
+      ||  report.rejections[2].record != 4  ||  report.rejections[2].error != Error::STATE_NAME
+      ||  report.count( Error::ZIP_CODE ) != 1  ||  report.count( Error::ZIP_CODE_VALUE ) != 0  ||  report.count( Error::EMPTY_RECORD ) != 0 )
+      {
+        throw PropertyValueException( "Batch validation report is wrong", __LINE__, __func__, __FILE__ );
+      }
+
+      Address blank = good[0];
+      if( Addresses::tryFromRecord( Utilities::Records::split( "" ), blank ) != Error::EMPTY_RECORD  ||  blank != good[0] )
+      {
+        throw PropertyValueException( "Blank record was not reported as empty", __LINE__, __func__, __FILE__ );
+      }
+
+      // the extraction operator still throws on the first bad record
+      std::istringstream stream( records );
+      Address temp;
+      stream >> temp;
+      try
+      {
+        stream >> temp;
+        throw UndetectedException( "Undetected Wrong State or State Code", __LINE__, __func__, __FILE__ );
+      }
+      catch( Address::StateCodeException & ) {}
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runAddressValidationTest()
+
+
+  /****************************************************************************
+  ** Exception Message Verification & Regression Test
+  ****************************************************************************/
+  void runExceptionTest()
+  {
+    using Addresses::Address;
+
+    // a rethrown exception's message includes the one it was built from, and what() returns the same text every time
+    try
+    {
+      try
+      {
+        Address( "1 Main Street", "Springfield", "XX", "12345" );
+        throw UndetectedException( "Undetected Wrong State or State Code", __LINE__, __func__, __FILE__ );
+      }
+      catch( const Address::StateCodeException & ex )
+      {
+        throw Address::AddressExceptions( ex, "while loading", __LINE__, __func__, __FILE__ );
+      }
+    }
+    catch( const Address::AddressExceptions & ex )
+    {
+      const std::string message = ex.what();
+      const auto inner = message.find( "State abbreviation not valid" );
+      const auto outer = message.find( "while loading" );
+      if( inner == std::string::npos  ||  outer == std::string::npos  ||  inner > outer
+      ||  message.find( typeid( Address::StateCodeException ).name() ) == std::string::npos
+      ||  message.find( std::string( "in function \"" ) + __func__ + '"' ) == std::string::npos )
+      {
+        throw PropertyValueException( "Chained exception message is wrong", __LINE__, __func__, __FILE__ );
+      }
+      if( ex.what() != message  ||  Address::AddressExceptions( ex ).what() != message )
+      {
+        throw PropertyValueException( "Exception message changed between calls", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // exceptions from outside the Library are chained by their text
+    {
+      const PropertyValueException ex( std::out_of_range( "outside" ), "inside", 1, "function", "file" );
+      const std::string message = ex.what();
+      if( message.compare( 0, 7, "outside" ) != 0  ||  message.find( "inside\n**** thrown at line 1 in function \"function\" in file \"file\"" ) == std::string::npos )
+      {
+        throw PropertyValueException( "Chained exception message is wrong", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // what() may be called from several threads at once
+    {
+      const Address::ZipCodeException ex( "shared", __LINE__, __func__, __FILE__ );
+      std::vector<const char *> messages( 8 );
+      std::vector<std::thread>  threads;
+      for( std::size_t i = 0; i < messages.size(); ++i )  threads.emplace_back( [&ex, &messages, i] { messages[i] = ex.what(); } );
+      for( auto & thread : threads )  thread.join();
+
+      for( const char * message : messages )
+      {
+        if( message != messages[0] )  throw PropertyValueException( "Exception message formatted more than once", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runExceptionTest()
+
+
+  /****************************************************************************
+  ** Employee Name Tokenizer Verification & Regression Test
+  **
+  ** The tokenizer must split names exactly as the regular expression based
+  ** modifiers did, including the way they recursed on names with several
+  ** commas.
+  ****************************************************************************/
+  void runEmployeeNameTest()
+  {
+    using Employees::Employee;
+
+    // the original modifiers, kept as the reference
+    struct Reference
+    {
+      std::string first;
+      std::string last;
+
+      void name( const std::string & newName )
+      {
+        std::smatch match;
+        if( std::regex_search( newName, match, std::regex( "([[:space:]]*,[[:space:]]*)" ) ) )
+        {
+          lastName( match.prefix() );
+          firstName( match.suffix() );
+        }
+        else
+        {
+          lastName( newName );
+          firstName( "" );
+        }
+      }
+      void firstName( const std::string & newName )
+      {
+        if( std::regex_search( newName, std::regex( "([[:space:]]*,[[:space:]]*)" ) ) ) name( newName );
+        else                                                                            first = newName;
+      }
+      void lastName( const std::string & newName )
+      {
+        if( std::regex_search( newName, std::regex( "([[:space:]]*,[[:space:]]*)" ) ) ) name( newName );
+        else                                                                            last = newName;
+      }
+    };
+
+    // every short name over an alphabet that exercises the edge cases, plus random longer ones
+    std::vector<std::string> names = { "", ",", " , ", "Disney, Walt", "  Disney  ,  Walt  ", "A, B, C", "A ,  , B", "A,\t\nB", "Last," };
+    const char alphabet[] = { 'a', ' ', ',', '\t' };
+    for( std::size_t length = 1; length <= 4; ++length )
+    {
+      std::size_t combinations = 1;
+      for( std::size_t i = 0; i < length; ++i )  combinations *= sizeof( alphabet );
+      for( std::size_t n = 0; n < combinations; ++n )
+      {
+        std::string name;
+        for( std::size_t i = 0, rest = n; i < length; ++i, rest /= sizeof( alphabet ) )  name += alphabet[rest % sizeof( alphabet )];
+        names.push_back( name );
+      }
+    }
+    std::mt19937 random( 12 );
+    for( std::size_t n = 0; n < 300; ++n )
+    {
+      std::string name( random() % 30, 'x' );
+      for( auto & c : name )  c = " ,\tQrs"[random() % 6];
+      names.push_back( name );
+    }
+
+    for( const auto & name : names )
+    {
+      Reference expected;
+      Employee  actual;
+
+      expected.name( name );
+      actual.name( name );
+      if( actual.firstName() != expected.first  ||  actual.lastName() != expected.last )
+      {
+        throw PropertyValueException( "Name split differently than the original modifier for \"" + name + '"', __LINE__, __func__, __FILE__ );
+      }
+
+      // the single name modifiers fall back to name() when given a comma
+      expected = { "keep", "keep" };
+      actual   = Employee( "keep", "keep" );
+      expected.firstName( name );
+      actual.firstName( name );
+      expected.lastName( name + "z" );
+      actual.lastName( name + "z" );
+      if( actual.firstName() != expected.first  ||  actual.lastName() != expected.last )
+      {
+        throw PropertyValueException( "Name modifier differs from the original for \"" + name + '"', __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // batch normalization builds the same employees as the constructor
+    {
+      const std::vector<Utilities::StringView> feed = { "Disney, Walt", "Skywalker", " Holmes ,Sherlock ", "A, B, C" };
+      std::vector<Employee> employees( 1 );
+      Employees::Names::normalize( feed, employees );
+
+      if( employees.size() != feed.size() + 1 )  throw PropertyValueException( "Batch normalization count is wrong", __LINE__, __func__, __FILE__ );
+      for( std::size_t i = 0; i < feed.size(); ++i )
+      {
+        if( employees[i + 1] != Employee( std::string( feed[i].data(), feed[i].size() ) ) )
+        {
+          throw PropertyValueException( "Batch normalization differs from Employee::name()", __LINE__, __func__, __FILE__ );
+        }
+      }
+      if( employees[3].lastName() != " Holmes"  ||  employees[3].firstName() != "Sherlock "  ||  employees[4].lastName() != "B" )
+      {
+        throw PropertyValueException( "Batch normalization split names wrong", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runEmployeeNameTest()
+
+
+  /****************************************************************************
+  ** Record Formatting Verification & Regression Test
+  **
+  ** appendTo(), formatTo(), the string conversions and operator<< must all
+  ** produce the same record text.
+  ****************************************************************************/
+  void runRecordFormattingTest()
+  {
+    auto verify = []( const auto & record, const std::string & expected )
+    {
+      std::ostringstream stream;
+      stream << record;
+
+      std::string appended = "prefix";
+      record.appendTo( appended );
+
+      if( stream.str() != expected  ||  static_cast<std::string>( record ) != expected  ||  appended != "prefix" + expected )
+      {
+        throw PropertyValueException( "Record text is wrong", __LINE__, __func__, __FILE__ );
+      }
+
+      // formatTo() writes nothing unless the whole record fits
+      std::string buffer( expected.size() + 1, '#' );
+      if( record.formatTo( &buffer[0], expected.size() - 1 ) != expected.size()  ||  buffer != std::string( expected.size() + 1, '#' ) )
+      {
+        throw PropertyValueException( "formatTo() wrote a record that doesn't fit", __LINE__, __func__, __FILE__ );
+      }
+      if( record.formatTo( &buffer[0], expected.size() ) != expected.size()  ||  buffer != expected + '#' )
+      {
+        throw PropertyValueException( "formatTo() record is wrong", __LINE__, __func__, __FILE__ );
+      }
+    };
+
+    const std::string longStreet( 300, 's' );   // longer than operator<<'s stack buffer
+
+    const Addresses::Address address( "1014 Vine Street", "Cincinnati", "oh", "45202-1100" );
+    verify( address, "1014 Vine Street\x03" "Cincinnati\x03" "Ohio\x03" "45202-1100\x04" );
+    verify( Addresses::Address( longStreet, "", "WA", 99201UL ), longStreet + "\x03\x03" "Washington\x03" "99201\x04" );
+    verify( Addresses::Address(), "\x03\x03\x03\x04" );
+    verify( Companies::Company( "The Kroger Co" ), "The Kroger Co\x04" );
+    verify( Companies::Company( longStreet ), longStreet + "\x04" );
+    verify( Employees::Employee( "Bjarne", "Stroustrup" ), "Bjarne\x03Stroustrup\x04" );
+    verify( Employees::Employee(), "\x03\x04" );
+
+    // the views see the stored text
+    const Employees::Employee employee( "Lovelace, Ada" );
+    if( address.streetView() != "1014 Vine Street"  ||  address.cityView() != "Cincinnati"  ||  address.stateView() != "Ohio"
+    ||  Companies::Company( "CSUF" ).nameView() != "CSUF"  ||  employee.firstNameView() != "Ada"  ||  employee.lastNameView() != "Lovelace" )
+    {
+      throw PropertyValueException( "View does not match the stored text", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runRecordFormattingTest()
+
+
+  /****************************************************************************
+  ** Move Semantics Verification & Regression Test
+  **
+  ** Constructing from copies of strings may allocate at most once per field,
+  ** and constructing from temporaries must not allocate at all.
+  ****************************************************************************/
+  void runMoveSemanticsTest()
+  {
+    using Addresses::Address;
+    using Employees::Employee;
+
+    // long enough that no string fits in the small string buffer
+    const std::string street( 40, 's' );
+    const std::string city  ( 40, 'c' );
+    const std::string first ( 40, 'f' );
+    const std::string last  ( 40, 'l' );
+    const std::string state = "Washington";
+    const std::string zip   = "99201-1234";
+
+    // allocations made by build, not counting building its arguments
+    auto countAllocations = []( auto build )
+    {
+      const std::size_t before = allocations;
+      build();
+      return allocations - before;
+    };
+
+    // copies:  one allocation per string that has to be copied (street, city, first and last names), none for the state and zip code
+    std::size_t count = countAllocations( [&] { Address address( street, city, state, zip ); } );
+    if( count > 2 )  throw PropertyValueException( "Address constructor made " + std::to_string( count ) + " allocations", __LINE__, __func__, __FILE__ );
+
+    count = countAllocations( [&] { Employee employee( first, last ); } );
+    if( count > 2 )  throw PropertyValueException( "Employee constructor made " + std::to_string( count ) + " allocations", __LINE__, __func__, __FILE__ );
+
+    // temporaries are moved all the way into the object
+    {
+      std::string streetCopy = street, cityCopy = city, firstCopy = first, lastCopy = last, nameCopy = first;
+
+      count = countAllocations( [&] { Address address( std::move( streetCopy ), std::move( cityCopy ), state, zip ); } );
+      if( count != 0 )  throw PropertyValueException( "Address constructor made " + std::to_string( count ) + " allocations", __LINE__, __func__, __FILE__ );
+
+      count = countAllocations( [&] { Employee employee( std::move( firstCopy ), std::move( lastCopy ) ); } );
+      if( count != 0 )  throw PropertyValueException( "Employee constructor made " + std::to_string( count ) + " allocations", __LINE__, __func__, __FILE__ );
+
+      Companies::Company company;
+      count = countAllocations( [&] { company.name( std::move( nameCopy ) ); } );
+      if( count != 0  ||  company.name() != first )  throw PropertyValueException( "Company modifier copied its argument", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runMoveSemanticsTest()
+
+
+  /****************************************************************************
+  ** Ordering and Collation Verification & Regression Test
+  **
+  ** operator< must be a strict weak ordering, and sorting by collation keys
+  ** must give exactly the order std::stable_sort gives with operator<.
+  ****************************************************************************/
+  void runCollationTest()
+  {
+    using Addresses::Address;
+
+    // lots of ties in every field
+    std::vector<Address> addresses;
+    {
+      const char * states[]  = { "CA", "Ohio", "WA", "texas" };
+      const char * cities[]  = { "Anaheim", "Buena Park", "Anaheim Hills", "", "anaheim" };
+      const char * streets[] = { "1 Main Street", "10 Main Street", "2 Main Street", "" };
+      std::mt19937 random( 15 );
+      for( std::size_t i = 0; i < 3000; ++i )
+      {
+        addresses.emplace_back( streets[random() % 4], cities[random() % 5], states[random() % 4], 90000 + random() % 5 );
+        if( random() % 3 == 0 )  addresses.back().zipCode( std::to_string( 90000 + random() % 5 ) + "-" + std::to_string( 1000 + random() % 9000 ) );
+      }
+    }
+
+    // each field decides only when the ones before it are equal
+    {
+      const Address a( "9 Z Street", "Anaheim", "CA", 99201UL );
+      const Address b( "1 A Street", "Zion", "CA", 10001UL );
+      const Address c( "1 A Street", "Anaheim", "OH", 10001UL );
+      if( !( a < b )  ||  b < a  ||  !( a < c )  ||  !( b < c )  ||  !( a <= b )  ||  !( b >= a )  ||  !( c > a ) )
+      {
+        throw RelationalTestFailure( "Address ordering is not lexicographic", __LINE__, __func__, __FILE__ );
+      }
+
+      const Employees::Employee z( "Zed", "Adams" );
+      const Employees::Employee y( "Amy", "Baker" );
+      if( !( z < y )  ||  y < z  ||  !( y > z )  ||  !( z <= z )  ||  !( z >= z ) )
+      {
+        throw RelationalTestFailure( "Employee ordering is not lexicographic", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // strict weak ordering:  irreflexive, transitive, and equivalence (neither is less) is transitive and matches operator==
+    for( std::size_t i = 0; i < 60; ++i )
+    {
+      const Address & a = addresses[i];
+      if( a < a )  throw RelationalTestFailure( "operator< is not irreflexive", __LINE__, __func__, __FILE__ );
+      for( std::size_t j = 0; j < 60; ++j )
+      {
+        const Address & b = addresses[j];
+        if( ( !( a < b )  &&  !( b < a ) ) != ( a == b ) )  throw RelationalTestFailure( "Equivalence does not match operator==", __LINE__, __func__, __FILE__ );
+        for( std::size_t k = 0; k < 60; ++k )
+        {
+          const Address & c = addresses[k];
+          if( a < b  &&  b < c  &&  !( a < c ) )  throw RelationalTestFailure( "operator< is not transitive", __LINE__, __func__, __FILE__ );
+        }
+      }
+    }
+
+    // keys order the same as operator<
+    const auto keys = Addresses::Collation::keys( addresses );
+    for( std::size_t i = 0; i + 1 < addresses.size(); ++i )
+    {
+      const auto & a  = keys[i];
+      const auto & b  = keys[i + 1];
+      const bool less = a.high < b.high  ||  ( a.high == b.high  &&  ( a.low >> 32 ) < ( b.low >> 32 ) );
+      if( less != ( addresses[i] < addresses[i + 1] )  ||  a.sameAddress( b ) != ( addresses[i] == addresses[i + 1] ) )
+      {
+        throw RelationalTestFailure( "Sort key does not match operator<", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // the same records in the same order as a stable sort, from either a vector or a table
+    {
+      std::vector<Address> expected = addresses;
+      std::stable_sort( expected.begin(), expected.end() );
+
+      std::vector<Address> sorted = addresses;
+      Addresses::Collation::sort( sorted );
+
+      auto tableKeys = Addresses::Collation::keys( Addresses::AddressTable( addresses ) );
+      const auto order = Addresses::Collation::order( tableKeys );
+
+      for( std::size_t i = 0; i < expected.size(); ++i )
+      {
+        if( sorted[i] != expected[i]  ||  sorted[i].zipCode() != expected[i].zipCode()  ||  addresses[order[i]].zipCode() != expected[i].zipCode()  ||  addresses[order[i]] != expected[i] )
+        {
+          throw RelationalTestFailure( "Collation sort differs from std::stable_sort", __LINE__, __func__, __FILE__ );
+        }
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runCollationTest()
+
+
+  /****************************************************************************
+  ** Presort (Radix Sort) Verification & Regression Test
+  **
+  ** The radix presort must give exactly the order std::stable_sort gives with
+  ** the presort comparison, with any number of threads.
+  ****************************************************************************/
+  void runPresortTest()
+  {
+    using Addresses::Address;
+
+    // several ZIP3s, ties in every field, and a couple of addresses without a zip code
+    std::vector<Address> addresses( 2 );
+    {
+      const char * states[]  = { "CA", "Ohio", "WA" };
+      const char * streets[] = { "1 Main Street", "10 Main Street", "2 Main Street", "" };
+      std::mt19937 random( 16 );
+      for( std::size_t i = 0; i < 5000; ++i )
+      {
+        const unsigned long zip5 = ( random() % 3 == 0 ? 501 : 90000 + 100 * ( random() % 30 ) ) + random() % 3;
+        const std::string   plus4 = random() % 2 ? "" : "-" + std::to_string( 1000 + random() % 3 );
+        std::string zip = std::to_string( zip5 );
+        zip = std::string( 5 - zip.size(), '0' ) + zip + plus4;
+        addresses.emplace_back( streets[random() % 4], "City " + std::to_string( i ), states[random() % 3], zip );
+      }
+      addresses.emplace_back();
+    }
+
+    std::vector<std::uint32_t> expected( addresses.size() );
+    std::iota( expected.begin(), expected.end(), 0 );
+    std::stable_sort( expected.begin(), expected.end(), [&addresses]( std::uint32_t lhs, std::uint32_t rhs )
+    {
+      return Addresses::Presort::before( addresses[lhs], addresses[rhs] );
+    } );
+
+    const Addresses::AddressTable table( addresses );
+    for( std::size_t threads : { 1, 2, 7 } )
+    {
+      if( Addresses::Presort::order( addresses, threads ) != expected  ||  Addresses::Presort::order( table, threads ) != expected )
+      {
+        throw RelationalTestFailure( "Radix presort differs from std::stable_sort", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // zip code, then +4, then state, then street
+    {
+      std::vector<Address> mailing = { {"2 Main Street", "A", "WA", "90620-1001"},
+                                       {"1 Main Street", "B", "WA", "90620-1001"},
+                                       {"1 Main Street", "C", "CA", "90620-1001"},
+                                       {"9 Main Street", "D", "CA", "90620"},
+                                       {"1 Main Street", "E", "CA", "10001-9998"} };
+      Addresses::Presort::sort( mailing, 2 );
+
+      std::string cities;
+      for( const auto & address : mailing )  cities += address.city();
+      if( cities != "EDCBA" )  throw RelationalTestFailure( "Presort order is wrong: " + cities, __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runPresortTest()
+
+
+
+  /****************************************************************************
+  ** External Sort Verification & Regression Test
+  **
+  ** Sorting a file through runs on disk must give exactly what std::stable_sort
+  ** gives in memory, however many runs and merge passes it takes.
+  ****************************************************************************/
+  void runExternalSortTest()
+  {
+    using Addresses::Address;
+
+    // the loser tree on its own:  merge sorted lists, ties go to the lower list
+    {
+      const std::vector<std::vector<int>> lists = { {1, 4, 9}, {2, 4}, {0, 9, 9, 10}, {4}, {3} };
+      std::vector<std::size_t>            next( lists.size(), 0 );
+      auto less = [&]( std::size_t lhs, std::size_t rhs ) { return lists[lhs][next[lhs]] < lists[rhs][next[rhs]]; };
+
+      Utilities::LoserTree<decltype( less )> tree( lists.size(), less );
+      std::string merged;
+      while( !tree.empty() )
+      {
+        const std::size_t list = tree.winner();
+        merged += std::to_string( lists[list][next[list]] ) + ':' + std::to_string( list ) + ' ';
+        tree.replay( ++next[list] == lists[list].size() );
+      }
+      if( merged != "0:2 1:0 2:1 3:4 4:0 4:1 4:3 9:0 9:2 9:2 10:2 " )  throw RelationalTestFailure( "Loser tree merge is wrong: " + merged, __LINE__, __func__, __FILE__ );
+    }
+
+    std::vector<Address> addresses;
+    {
+      const char * states[]  = { "CA", "Ohio", "WA" };
+      const char * streets[] = { "1 Main Street", "10 Main Street", "2 Main Street" };
+      std::mt19937 random( 17 );
+      for( std::size_t i = 0; i < 2000; ++i )
+      {
+        addresses.emplace_back( streets[random() % 3], "City " + std::to_string( random() % 20 ), states[random() % 3], 90000 + random() % 5 );
+      }
+    }
+
+    const std::string input  = "runExternalSortTest.in.tmp";
+    const std::string output = "runExternalSortTest.out.tmp";
+    {
+      std::ofstream file( input, std::ios::binary | std::ios::trunc );
+      for( const auto & address : addresses )  file << address;
+    }
+
+    std::vector<Address> expected = addresses;
+    std::stable_sort( expected.begin(), expected.end() );
+    std::string expectedText;
+    for( const auto & address : expected )  address.appendTo( expectedText );
+
+    // everything in memory, one merge of every run, and several merge passes
+    const std::size_t budgets[] = { 64 * 1024 * 1024, 64 * 1024, 16 * 1024 };
+    const std::size_t fanIns[]  = { 0,                16,        3 };
+    for( std::size_t trial = 0; trial < 3; ++trial )
+    {
+      Addresses::ExternalSort::Options options;
+      options.memoryBudget = budgets[trial];
+      options.maxFanIn     = fanIns[trial];
+      const auto statistics = Addresses::ExternalSort::sortFile( input, output, options );
+
+      std::ifstream file( output, std::ios::binary );
+      const std::string sorted( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+      if( sorted != expectedText )  throw RelationalTestFailure( "External sort differs from std::stable_sort", __LINE__, __func__, __FILE__ );
+
+      if( statistics.records != addresses.size()  ||  statistics.outputBytes != sorted.size() )
+      {
+        throw RegressionTestException( "External sort statistics are wrong", __LINE__, __func__, __FILE__ );
+      }
+      if( ( trial == 0 ) != ( statistics.runs == 0 )  ||  ( trial == 1  &&  statistics.mergePasses != 1 )  ||  ( trial == 2  &&  statistics.mergePasses < 2 ) )
+      {
+        throw RegressionTestException( "Unexpected runs or merge passes", __LINE__, __func__, __FILE__ );
+      }
+
+      // the run files are gone
+      if( std::ifstream( "./" + output + ".run0" ) )  throw RegressionTestException( "Run file left behind", __LINE__, __func__, __FILE__ );
+    }
+
+    // a bad record stops the sort with the same exception operator>> throws
+    {
+      std::ofstream( input, std::ios::binary | std::ios::app ) << "1 Main Street\x03Springfield\x03XX\x03" << "12345\x04";
+      try
+      {
+        Addresses::ExternalSort::sortFile( input, output );
+        throw UndetectedException( "Invalid record not detected", __LINE__, __func__, __FILE__ );
+      }
+      catch( const Address::StateCodeException & ) {}
+    }
+
+    std::remove( input.c_str() );
+    std::remove( output.c_str() );
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runExternalSortTest()
+
+
+
+  /****************************************************************************
+  ** Hash Verification & Regression Test
+  **
+  ** Objects that compare equal must hash equal, modifiers must drop a cached
+  ** hash, and distinct objects should spread over the low bits hash tables use.
+  ****************************************************************************/
+  void runHashTest()
+  {
+    using Addresses::Address;
+    using Companies::Company;
+    using Employees::Employee;
+
+    // equal except for the +4, which operator== ignores
+    {
+      const Address first ( "1 Main Street", "Fullerton", "CA", "92831-1234" );
+      const Address second( "1 Main Street", "Fullerton", "California", "92831" );
+      if( first != second  ||  std::hash<Address>()( first ) != std::hash<Address>()( second ) )
+      {
+        throw RelationalTestFailure( "Equal addresses hash differently", __LINE__, __func__, __FILE__ );
+      }
+
+      std::unordered_set<Address> set = { first, second, Address( "1 Main Street", "Fullerton", "CA", "92832" ) };
+      if( set.size() != 2  ||  set.count( Address( "1 Main Street", "Fullerton", "CA", 92831 ) ) != 1 )
+      {
+        throw RelationalTestFailure( "unordered_set<Address> membership is wrong", __LINE__, __func__, __FILE__ );
+      }
+
+      const std::unordered_set<Company>  companies = { Company( "Acme" ), Company( "Acme" ), Company( "Initech" ) };
+      const std::unordered_set<Employee> employees = { Employee( "Doe, Jane" ), Employee( "Jane", "Doe" ), Employee( "Doe, John" ) };
+      if( companies.size() != 2  ||  employees.size() != 2  ||  employees.count( Employee( "Doe,Jane" ) ) != 1 )
+      {
+        throw RelationalTestFailure( "unordered_set membership is wrong", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // a modified object hashes like a fresh one with the same fields, and copies keep the cached hash
+    {
+      Address address( "1 Main Street", "Fullerton", "CA", 92831 );
+      const Address copy = address;
+      address.hash();
+      address.street( "2 Main Street" );
+      if( address.hash() != Address( "2 Main Street", "Fullerton", "CA", 92831 ).hash() )  throw RegressionTestException( "Address hash not reset by street()", __LINE__, __func__, __FILE__ );
+      address.zipCode( "92832" );
+      if( address.hash() != Address( "2 Main Street", "Fullerton", "CA", 92832 ).hash() )  throw RegressionTestException( "Address hash not reset by zipCode()", __LINE__, __func__, __FILE__ );
+      address.state( "WA" ).city( "Seattle" );
+      if( address.hash() != Address( "2 Main Street", "Seattle", "WA", 92832 ).hash() )    throw RegressionTestException( "Address hash not reset by state()", __LINE__, __func__, __FILE__ );
+      if( copy.hash() != Address( "1 Main Street", "Fullerton", "CA", 92831 ).hash() )      throw RegressionTestException( "Copied address hash is wrong", __LINE__, __func__, __FILE__ );
+
+      Utilities::Binary::Buffer buffer;
+      copy.serialize( buffer );
+      Utilities::Binary::Reader reader( buffer.view() );
+      if( address.deserialize( reader ).hash() != copy.hash() )  throw RegressionTestException( "Address hash not reset by deserialize()", __LINE__, __func__, __FILE__ );
+
+      Employee employee( "Doe, Jane" );
+      employee.hash();
+      employee.lastName( "Roe" );
+      if( employee.hash() != Employee( "Roe, Jane" ).hash() )  throw RegressionTestException( "Employee hash not reset", __LINE__, __func__, __FILE__ );
+      employee.firstName( "Smith, John" );
+      if( employee.hash() != Employee( "Smith, John" ).hash() )  throw RegressionTestException( "Employee hash not reset", __LINE__, __func__, __FILE__ );
+
+      Company company( "Acme" );
+      company.hash();
+      if( company.name( "Initech" ).hash() != Company( "Initech" ).hash() )  throw RegressionTestException( "Company hash not reset", __LINE__, __func__, __FILE__ );
+    }
+
+    // field boundaries matter, and similar addresses spread evenly over the low 10 bits
+    {
+      if( Employee( "ab", "c" ).hash() == Employee( "a", "bc" ).hash() )  throw RegressionTestException( "Field boundary not hashed", __LINE__, __func__, __FILE__ );
+
+      constexpr std::size_t COUNT   = 100000;
+      constexpr std::size_t BUCKETS = 1024;
+      std::vector<std::size_t>        buckets( BUCKETS, 0 );
+      std::unordered_set<std::size_t> hashes;
+      for( std::size_t i = 0; i < COUNT; ++i )
+      {
+        const std::size_t hash = Address( std::to_string( i % 1000 ) + " Main Street", "City " + std::to_string( i / 1000 ), "CA", 90000 + i % 7 ).hash();
+        hashes.insert( hash );
+        ++buckets[hash % BUCKETS];
+      }
+      if( hashes.size() != COUNT )  throw RegressionTestException( "Hash collisions among distinct addresses", __LINE__, __func__, __FILE__ );
+      if( *std::max_element( buckets.begin(), buckets.end() ) > 2 * COUNT / BUCKETS )  throw RegressionTestException( "Hash low bits are skewed", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runHashTest()
+
+
+
+  /****************************************************************************
+  ** Deduplication Verification & Regression Test
+  **
+  ** The deduplicator must pass on exactly the first occurrence of each address,
+  ** whether or not it has to spill partitions (and spill them again) to disk,
+  ** without holding more than its memory budget.
+  ****************************************************************************/
+  void runDeduplicationTest()
+  {
+    using Addresses::Address;
+
+    // a feed that is about a third duplicates, some differing only in the +4 or in how the state is written
+    std::vector<Address> feed;
+    {
+      const char * states[] = { "CA", "California", "WA" };
+      std::mt19937 random( 19 );
+      for( std::size_t i = 0; i < 6000; ++i )
+      {
+        const std::size_t   n   = random() % 4000;
+        const unsigned long zip = 90000 + n % 50;
+        feed.emplace_back( std::to_string( n ) + " Main Street", "City " + std::to_string( n % 7 ), states[( n % 2 ) + ( random() % 2 ) * ( n % 2 == 0 )],
+                           std::to_string( zip ) + ( random() % 2 ? "" : "-" + std::to_string( 1000 + random() % 9 ) ) );
+      }
+    }
+    const std::vector<Address> doNotMail = { feed[10], feed[20] };
+
+    std::string expected;
+    std::size_t expectedDuplicates = 0;
+    {
+      std::unordered_set<Address> seen( doNotMail.begin(), doNotMail.end() );
+      for( const auto & address : feed )
+      {
+        if( seen.insert( address ).second )  address.appendTo( expected );
+        else                                 ++expectedDuplicates;
+      }
+    }
+
+    auto sortedRecords = []( const std::string & text )
+    {
+      std::vector<std::string> records;
+      std::istringstream stream( text );
+      for( std::string record; std::getline( stream, record, Utilities::Records::RECORD_SEPARATOR ); )  records.push_back( record );
+      std::sort( records.begin(), records.end() );
+      return records;
+    };
+
+    // in memory (order kept), spilling, and spilling so much that spilled partitions spill again
+    const std::size_t budgets[] = { 64 * 1024 * 1024, 256 * 1024, 32 * 1024 };
+    for( std::size_t trial = 0; trial < 3; ++trial )
+    {
+      Addresses::Deduplicator::Options options;
+      options.memoryBudget = budgets[trial];
+      options.partitions   = 4;
+
+      std::string unique;
+      Addresses::Deduplicator dedup( [&unique]( const Address & address ) { address.appendTo( unique ); }, options );
+      for( const auto & address : doNotMail )  dedup.remember( address );
+      for( const auto & address : feed )       dedup.insert( address );
+      dedup.finish();
+
+      const auto & statistics = dedup.statistics();
+      if( statistics.records != feed.size()  ||  statistics.duplicates != expectedDuplicates  ||  statistics.unique + statistics.duplicates != feed.size() )
+      {
+        throw RegressionTestException( "Deduplication counts are wrong", __LINE__, __func__, __FILE__ );
+      }
+      if( trial == 0 ? unique != expected : sortedRecords( unique ) != sortedRecords( expected ) )
+      {
+        throw RelationalTestFailure( "Deduplicated addresses are wrong", __LINE__, __func__, __FILE__ );
+      }
+      if( ( trial == 0 ) != ( statistics.spills == 0 )  ||  ( trial == 2  &&  statistics.spills <= options.partitions ) )
+      {
+        throw RegressionTestException( "Unexpected number of spills", __LINE__, __func__, __FILE__ );
+      }
+
+      // the sets and spill buffers, at every level of replay, stay within the budget
+      if( statistics.peakBytes == 0  ||  statistics.peakBytes > options.memoryBudget )
+      {
+        throw RegressionTestException( "Deduplication held " + std::to_string( statistics.peakBytes ) + " bytes, over its budget", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runDeduplicationTest()
+
+
+
+  /****************************************************************************
+  ** Bloom Filter Verification & Regression Test
+  **
+  ** A filter never misses an address on its list (under operator==), stays near
+  ** its false positive rate, and survives a save and load unchanged.
+  ****************************************************************************/
+  void runBloomFilterTest()
+  {
+    using Addresses::Address;
+
+    const std::string list  = "runBloomFilterTest.list.tmp";
+    const std::string image = "runBloomFilterTest.image.tmp";
+
+    constexpr std::size_t LISTED = 5000;
+    {
+      std::ofstream file( list, std::ios::binary | std::ios::trunc );
+      for( std::size_t i = 0; i < LISTED; ++i )  file << Address( std::to_string( i ) + " Main Street", "Fullerton", "CA", "92831-1234" );
+    }
+
+    const Utilities::BloomFilter filter = Addresses::buildFilter( list, 0.01 );
+    if( filter.size() != LISTED )  throw RegressionTestException( "Bloom filter holds the wrong number of addresses", __LINE__, __func__, __FILE__ );
+
+    // no false negatives, however the same address is written
+    for( std::size_t i = 0; i < LISTED; ++i )
+    {
+      if( !filter.mayContain( Address( std::to_string( i ) + " Main Street", "Fullerton", "California", 92831 ) ) )
+      {
+        throw RelationalTestFailure( "Bloom filter missed a listed address", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // false positives near the requested rate
+    constexpr std::size_t QUERIES = 50000;
+    std::size_t falsePositives = 0;
+    for( std::size_t i = 0; i < QUERIES; ++i )
+    {
+      falsePositives += filter.mayContain( Address( std::to_string( i ) + " Main Street", "Anaheim", "CA", 92801 ) );
+    }
+    if( falsePositives > QUERIES / 100 * 3 / 2 )
+    {
+      throw RegressionTestException( "Bloom filter false positive rate too high: " + std::to_string( falsePositives ), __LINE__, __func__, __FILE__ );
+    }
+
+    // the image loads back to the same filter, and a damaged one is refused
+    {
+      filter.save( image );
+      const Utilities::BloomFilter loaded = Utilities::BloomFilter::load( image );
+      if( loaded.size() != filter.size()  ||  loaded.bytes() != filter.bytes()  ||  loaded.hashCount() != filter.hashCount() )
+      {
+        throw SemmetricalIOFailure( "Bloom filter image changed its shape", __LINE__, __func__, __FILE__ );
+      }
+      for( std::size_t i = 0; i < 2 * LISTED; ++i )
+      {
+        const std::uint64_t hash = Address( std::to_string( i ) + " Main Street", "Fullerton", "CA", 92831 ).hash() * ( i % 2 ? 3 : 1 );
+        if( loaded.mayContainHash( hash ) != filter.mayContainHash( hash ) )  throw SemmetricalIOFailure( "Bloom filter image changed its bits", __LINE__, __func__, __FILE__ );
+      }
+
+      std::string bytes;
+      {
+        std::ifstream file( image, std::ios::binary );
+        bytes.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+      }
+      std::ofstream( image, std::ios::binary | std::ios::trunc ) << bytes.substr( 0, bytes.size() - 1 );
+      try
+      {
+        Utilities::BloomFilter::load( image );
+        throw UndetectedException( "Truncated Bloom filter image not detected", __LINE__, __func__, __FILE__ );
+      }
+      catch( const Utilities::BloomFilter::BloomFilterExceptions & ) {}
+
+      try
+      {
+        Utilities::BloomFilter( 10, 1.0 );
+        throw UndetectedException( "Bad false positive rate not detected", __LINE__, __func__, __FILE__ );
+      }
+      catch( const Utilities::BloomFilter::BloomFilterExceptions & ) {}
+    }
+
+    std::remove( list.c_str() );
+    std::remove( image.c_str() );
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runBloomFilterTest()
+
+
+
+  /****************************************************************************
+  ** Registry Verification & Regression Test
+  **
+  ** The state joins return exactly what a scan of every employee finds, equal
+  ** addresses are interned, and relocate and transfer move the reverse links.
+  ****************************************************************************/
+  void runRegistryTest()
+  {
+    using Addresses::Address;
+    using MailSystem::Registry;
+
+    const char * const states[] = { "OH", "CA", "TX", "NY", "WA" };
+
+    Registry registry;
+    std::mt19937 random( 2021 );
+    for( unsigned i = 0; i < 300; ++i )
+    {
+      const auto hq = registry.add( Address( std::to_string( i % 120 ) + " Main Street", "Springfield", states[ i % 120 % 5 ], 10000 + i % 120 ) );
+      registry.add( Companies::Company( "Company " + std::to_string( i ) ), hq );
+    }
+    for( unsigned i = 0; i < 3000; ++i )
+    {
+      registry.add( Employees::Employee( "First" + std::to_string( i ), "Last" ), static_cast<Registry::CompanyId>( random() % 300 ) );
+    }
+
+    if( registry.addressCount() != 120 )  throw RegressionTestException( "Registry did not intern equal addresses", __LINE__, __func__, __FILE__ );
+    if( registry.find( Address( "7 Main Street", "Springfield", "Texas", "10007-4321" ) ) != registry.headquartersOf( 7 ) )
+    {
+      throw RegressionTestException( "Registry lookup by address failed", __LINE__, __func__, __FILE__ );
+    }
+    if( registry.find( Companies::Company( "Company 300" ) ) != Registry::NONE )  throw RegressionTestException( "Registry found an unregistered company", __LINE__, __func__, __FILE__ );
+
+    // each join against a scan of every record
+    auto verifyJoins = [&]()
+    {
+      for( const auto code : states )
+      {
+        const auto state = Addresses::States::fromCode( code, 2 );
+
+        std::vector<Registry::CompanyId> companies;
+        for( Registry::CompanyId c = 0; c < registry.companyCount(); ++c )
+        {
+          if( registry.address( registry.headquartersOf( c ) ).stateOrdinal() == state )  companies.push_back( c );
+        }
+        std::vector<Registry::EmployeeId> employees;
+        for( Registry::EmployeeId e = 0; e < registry.employeeCount(); ++e )
+        {
+          if( registry.address( registry.headquartersOf( registry.employerOf( e ) ) ).stateOrdinal() == state )  employees.push_back( e );
+        }
+
+        auto joinedCompanies = registry.companiesHeadquarteredIn( state );
+        auto joinedEmployees = registry.employeesHeadquarteredIn( state );
+        std::sort( joinedCompanies.begin(), joinedCompanies.end() );
+        std::sort( joinedEmployees.begin(), joinedEmployees.end() );
+        if( joinedCompanies != companies  ||  joinedEmployees != employees )
+        {
+          throw RelationalTestFailure( std::string( "Registry join disagrees with a scan in " ) + code, __LINE__, __func__, __FILE__ );
+        }
+      }
+
+      for( Registry::CompanyId c = 0; c < registry.companyCount(); ++c )
+      {
+        const auto & staff = registry.employeesOf( c );
+        if( !std::is_sorted( staff.begin(), staff.end() ) )  throw RegressionTestException( "Registry employee list out of order", __LINE__, __func__, __FILE__ );
+        for( const auto e : staff )
+        {
+          if( registry.employerOf( e ) != c )  throw RelationalTestFailure( "Registry employee list disagrees with employer", __LINE__, __func__, __FILE__ );
+        }
+      }
+    };
+    verifyJoins();
+
+    // move some companies to another state and some employees to another company
+    const auto ohio = registry.add( Address( "1 Capitol Square", "Columbus", "OH", "43215" ) );
+    for( Registry::CompanyId c = 1; c < registry.companyCount(); c += 7 )  registry.relocate( c, ohio );
+    for( Registry::EmployeeId e = 0; e < registry.employeeCount(); e += 5 )  registry.transfer( e, static_cast<Registry::CompanyId>( random() % 300 ) );
+    if( registry.companiesAt( ohio ).size() != ( registry.companyCount() + 5 ) / 7 )
+    {
+      throw RegressionTestException( "Registry relocate lost a company", __LINE__, __func__, __FILE__ );
+    }
+    verifyJoins();
+
+    // bad Ids and duplicate companies
+    try
+    {
+      registry.employee( static_cast<Registry::EmployeeId>( registry.employeeCount() ) );
+      throw UndetectedException( "Unknown employee Id not detected", __LINE__, __func__, __FILE__ );
+    }
+    catch( const Registry::UnknownIdException & ) {}
+
+    try
+    {
+      registry.add( Employees::Employee( "Doe, Jane" ), Registry::NONE );
+      throw UndetectedException( "Unknown company Id not detected", __LINE__, __func__, __FILE__ );
+    }
+    catch( const Registry::UnknownIdException & ) {}
+
+    try
+    {
+      registry.add( Companies::Company( "Company 5" ), ohio );
+      throw UndetectedException( "Duplicate company not detected", __LINE__, __func__, __FILE__ );
+    }
+    catch( const Registry::DuplicateCompanyException & ) {}
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runRegistryTest()
+
+
+
+  /****************************************************************************
+  ** Concurrent Registry Verification & Regression Test
+  **
+  ** Readers see only whole batches while a writer publishes, a held snapshot
+  ** never changes, and a batch that throws publishes nothing.
+  ****************************************************************************/
+  void runConcurrentRegistryTest()
+  {
+    using MailSystem::Registry;
+    using MailSystem::ConcurrentRegistry;
+
+    constexpr unsigned COMPANIES = 50;
+    constexpr unsigned EMPLOYEES = 2000;
+
+    Registry initial;
+    for( unsigned c = 0; c < COMPANIES; ++c )
+    {
+      const auto hq = initial.add( Addresses::Address( std::to_string( c ) + " Main Street", "Springfield", c % 2 ? "OH" : "IL", 60000 + c ) );
+      initial.add( Companies::Company( "Company " + std::to_string( c ) ), hq );
+    }
+    for( unsigned e = 0; e < EMPLOYEES; ++e )  initial.add( Employees::Employee( "First" + std::to_string( e ), "Last" ), e % COMPANIES );
+
+    ConcurrentRegistry shared( std::move( initial ) );
+    const ConcurrentRegistry::Snapshot first = shared.snapshot();
+
+    // readers check each version they see is consistent while a writer moves employees and adds new ones
+    std::atomic<bool>     done( false );
+    std::atomic<unsigned> inconsistent( 0 );
+    std::vector<std::thread> readers;
+    for( unsigned t = 0; t < 4; ++t )
+    {
+      readers.emplace_back( [&]()
+      {
+        ConcurrentRegistry::Reader reader( shared );
+        while( !done.load() )
+        {
+          const Registry & registry = reader.current();
+          std::size_t staff = 0;
+          for( Registry::CompanyId c = 0; c < COMPANIES; ++c )
+          {
+            for( const auto e : registry.employeesOf( c ) )  inconsistent += registry.employerOf( e ) != c;
+            staff += registry.employeesOf( c ).size();
+          }
+          inconsistent += staff != registry.employeeCount();
+        }
+      } );
+    }
+
+    std::mt19937 random( 22 );
+    std::uint64_t version = 0;
+    for( unsigned batch = 0; batch < 200; ++batch )
+    {
+      version = shared.update( [&]( Registry & registry )
+      {
+        for( unsigned i = 0; i < 20; ++i )  registry.transfer( random() % EMPLOYEES, random() % COMPANIES );
+        registry.add( Employees::Employee( "Hire" + std::to_string( batch ), "Last" ), batch % COMPANIES );
+      } );
+    }
+    done = true;
+    for( auto & reader : readers )  reader.join();
+
+    if( inconsistent != 0 )  throw RelationalTestFailure( "Reader saw a partly applied batch", __LINE__, __func__, __FILE__ );
+    if( version != 200  ||  shared.version() != 200 )  throw RegressionTestException( "Registry versions not counted", __LINE__, __func__, __FILE__ );
+    if( shared.snapshot()->employeeCount() != EMPLOYEES + 200 )  throw RegressionTestException( "Registry batches lost", __LINE__, __func__, __FILE__ );
+
+    // the first version is untouched
+    if( first->employeeCount() != EMPLOYEES )  throw RegressionTestException( "Held snapshot changed", __LINE__, __func__, __FILE__ );
+    for( unsigned e = 0; e < EMPLOYEES; ++e )
+    {
+      if( first->employerOf( e ) != e % COMPANIES )  throw RegressionTestException( "Held snapshot changed", __LINE__, __func__, __FILE__ );
+    }
+
+    // a failed batch publishes nothing
+    try
+    {
+      shared.update( []( Registry & registry )
+      {
+        registry.transfer( 0, 1 );
+        registry.transfer( 0, COMPANIES );
+      } );
+      throw UndetectedException( "Unknown company Id not detected", __LINE__, __func__, __FILE__ );
+    }
+    catch( const Registry::UnknownIdException & ) {}
+    if( shared.version() != 200 )  throw RegressionTestException( "Failed batch was published", __LINE__, __func__, __FILE__ );
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runConcurrentRegistryTest()
+
+
+
+  /****************************************************************************
+  ** Zip Index Verification & Regression Test
+  **
+  ** Prefix and range queries return exactly what a scan of the zip codes finds,
+  ** in zip code order, as records are inserted one at a time.
+  ****************************************************************************/
+  void runZipIndexTest()
+  {
+    using Addresses::Address;
+    using Addresses::ZipIndex;
+
+    std::mt19937 random( 23 );
+    std::vector<Address> addresses;
+    for( unsigned i = 0; i < 20000; ++i )
+    {
+      const unsigned long zip5 = 90000 + random() % 4000;
+      addresses.emplace_back( std::to_string( i ) + " Main Street", "Fullerton", "CA",
+                              i % 3 ? std::to_string( zip5 ) : std::to_string( zip5 ) + '-' + std::to_string( 1000 + random() % 9000 ) );
+    }
+
+    // the Ids a scan finds, in (zip code, Id) order
+    auto scan = [&]( std::size_t records, std::uint32_t firstZip5, std::uint32_t lastZip5 )
+    {
+      std::vector<std::pair<Addresses::ZipCode::Packed, ZipIndex::RecordId>> found;
+      for( std::size_t i = 0; i < records; ++i )
+      {
+        const auto zip = addresses[i].packedZipCode();
+        if( Addresses::ZipCode::zip5( zip ) >= firstZip5  &&  Addresses::ZipCode::zip5( zip ) <= lastZip5 )  found.emplace_back( zip, i );
+      }
+      std::sort( found.begin(), found.end() );
+
+      std::vector<ZipIndex::RecordId> ids;
+      for( const auto & f : found )  ids.push_back( f.second );
+      return ids;
+    };
+
+    auto verify = [&]( const ZipIndex & index, std::size_t records )
+    {
+      if( index.size() != records )  throw RegressionTestException( "Zip index holds the wrong number of records", __LINE__, __func__, __FILE__ );
+
+      if( index.prefix( "9" )     != scan( records, 90000, 99999 )  ||
+          index.prefix( "926" )   != scan( records, 92600, 92699 )  ||
+          index.prefix( "91234" ) != scan( records, 91234, 91234 )  ||
+          index.prefix( "" )      != scan( records, 0,     99999 )  ||
+          index.prefix( "8" )     != scan( records, 80000, 89999 ) )
+      {
+        throw RelationalTestFailure( "Zip index prefix query disagrees with a scan", __LINE__, __func__, __FILE__ );
+      }
+      for( std::uint32_t first = 89990; first < 94010; first += 397 )
+      {
+        if( index.range( first, first + 10 ) != scan( records, first, first + 10 ) )
+        {
+          throw RelationalTestFailure( "Zip index range query disagrees with a scan", __LINE__, __func__, __FILE__ );
+        }
+      }
+    };
+
+    // built all at once, from objects and from a table
+    verify( ZipIndex( addresses ), addresses.size() );
+    verify( ZipIndex( Addresses::AddressTable( addresses ) ), addresses.size() );
+
+    // built one record at a time, through several merges
+    ZipIndex index;
+    for( std::size_t i = 0; i < addresses.size(); ++i )
+    {
+      index.insert( addresses[i], static_cast<ZipIndex::RecordId>( i ) );
+      if( i == 500  ||  i == 1025  ||  i == 7777  ||  i + 1 == addresses.size() )  verify( index, i + 1 );
+    }
+
+    // bad prefixes and empty ranges find nothing, and records without a zip code are not indexed
+    index.insert( Addresses::ZipCode::NONE, 99999 );
+    if( !index.prefix( "9x" ).empty()  ||  !index.prefix( "926000" ).empty()  ||  !index.range( 92000, 91000 ).empty()  ||
+        index.size() != addresses.size()  ||  !ZipIndex().prefix( "" ).empty() )
+    {
+      throw RegressionTestException( "Zip index found records it should not have", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runZipIndexTest()
+
+
+
+  /****************************************************************************
+  ** Company Name Index Verification & Regression Test
+  **
+  ** complete() returns the same names a sort of every match would, with and
+  ** without case folding, from memory, from a file and from a saved image.
+  ****************************************************************************/
+  void runNameIndexTest()
+  {
+    using Companies::NameIndex;
+
+    const std::string records = "runNameIndexTest.companies.tmp";
+    const std::string image   = "runNameIndexTest.image.tmp";
+
+    // names drawn from a small alphabet so prefixes share many names, some repeated and some differing only in case
+    std::mt19937 random( 24 );
+    std::vector<std::string> names;
+    for( unsigned i = 0; i < 6000; ++i )
+    {
+      std::string name;
+      const std::size_t length = 1 + random() % 6;
+      for( std::size_t c = 0; c < length; ++c )  name += "abcABC &"[random() % ( random() % 4 ? 3 : 8 )];
+      names.push_back( name );
+    }
+    {
+      std::ofstream file( records, std::ios::binary | std::ios::trunc );
+      for( const auto & name : names )  file << Companies::Company( name );
+    }
+
+    auto fold = []( std::string text )
+    {
+      for( auto & c : text )  c = static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+      return text;
+    };
+
+    // the best k names starting with prefix, by sorting every matching name.  Folded, names differing only in case count
+    // together, under their most common spelling.
+    auto expected = [&]( const std::string & prefix, std::size_t k, bool folded )
+    {
+      std::vector<std::string> matching;
+      for( const auto & name : names )
+      {
+        const std::string key = folded ? fold( name ) : name;
+        if( key.compare( 0, prefix.size(), folded ? fold( prefix ) : prefix ) == 0 )  matching.push_back( name );
+      }
+      std::sort( matching.begin(), matching.end() );
+
+      std::map<std::string, std::pair<std::string, std::uint32_t>> spellings;   // key -> (most common spelling, its count)
+      std::map<std::string, std::uint32_t>                         totals;
+      for( std::size_t i = 0, end; i < matching.size(); i = end )
+      {
+        for( end = i; end < matching.size()  &&  matching[end] == matching[i]; ++end ) {}
+        const std::string key  = folded ? fold( matching[i] ) : matching[i];
+        const auto        seen = static_cast<std::uint32_t>( end - i );
+        auto & spelling = spellings[key];
+        if( seen > spelling.second )  spelling = { matching[i], seen };
+        totals[key] += seen;
+      }
+
+      std::vector<std::pair<std::string, std::uint32_t>> counted;
+      for( const auto & total : totals )  counted.emplace_back( spellings[total.first].first, total.second );
+      std::stable_sort( counted.begin(), counted.end(), []( const std::pair<std::string, std::uint32_t> & lhs, const std::pair<std::string, std::uint32_t> & rhs )
+      {
+        return lhs.second > rhs.second;
+      } );
+      if( counted.size() > k )  counted.resize( k );
+      return counted;
+    };
+
+    auto verify = [&]( const NameIndex & index, bool folded )
+    {
+      if( index.caseInsensitive() != folded )  throw RegressionTestException( "Name index lost its case mode", __LINE__, __func__, __FILE__ );
+      for( const std::string prefix : { "", "a", "A", "ab", "Ab", "abc", "cab", "b&", "zzz", "abcabca" } )
+      {
+        for( const std::size_t k : { 1, 5, 50, 100000 } )
+        {
+          const auto want = expected( prefix, k, folded );
+          const auto got  = index.complete( prefix, k );
+          bool same = want.size() == got.size();
+          for( std::size_t i = 0; same  &&  i < got.size(); ++i )
+          {
+            same = std::string( got[i].name.data(), got[i].name.size() ) == want[i].first  &&  got[i].count == want[i].second;
+          }
+          if( !same  ||  ( k == 100000  &&  index.count( prefix ) != want.size() ) )
+          {
+            throw RelationalTestFailure( "Name index completion of \"" + prefix + "\" disagrees with a sort", __LINE__, __func__, __FILE__ );
+          }
+        }
+      }
+    };
+
+    for( const bool folded : { false, true } )
+    {
+      const NameIndex fromFile = NameIndex::fromFile( records, folded );
+      verify( fromFile, folded );
+
+      fromFile.save( image );
+      const NameIndex loaded = NameIndex::load( image );
+      if( loaded.bytes() != fromFile.bytes()  ||  loaded.size() != fromFile.size() )  throw SemmetricalIOFailure( "Name index image changed its shape", __LINE__, __func__, __FILE__ );
+      verify( loaded, folded );
+    }
+
+    // a damaged image is refused, and an empty index saves and loads
+    {
+      std::string bytes;
+      {
+        std::ifstream file( image, std::ios::binary );
+        bytes.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+      }
+      std::ofstream( image, std::ios::binary | std::ios::trunc ) << bytes.substr( 0, bytes.size() - 1 );
+      try
+      {
+        NameIndex::load( image );
+        throw UndetectedException( "Truncated name index image not detected", __LINE__, __func__, __FILE__ );
+      }
+      catch( const NameIndex::NameIndexExceptions & ) {}
+
+      // names out of order or a tree node past the last name would have queries read past the image
+      const NameIndex small( { "acme", "ACME", "Acme", "acme", "beta" }, true );
+      if( small.size() != 2  ||  small.complete( "a", 5 ).size() != 1  ||  small.complete( "a", 5 )[0].count != 4  ||  small.complete( "a", 5 )[0].name != "acme" )
+      {
+        throw RelationalTestFailure( "Case insensitive name index kept names differing in case apart", __LINE__, __func__, __FILE__ );
+      }
+      small.save( image );
+      {
+        std::ifstream file( image, std::ios::binary );
+        bytes.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+      }
+      const std::size_t offsets = 32, tree = offsets + 3 * 4 + 2 * 4;   // 2 names:  3 offsets, 2 counts, then 4 tree nodes
+      for( const std::size_t damaged : { offsets + 4, tree + 2 * 4 + 4 } )
+      {
+        std::string corrupt = bytes;
+        const std::uint32_t bad = 100;
+        std::memcpy( &corrupt[damaged], &bad, sizeof( bad ) );
+        std::ofstream( image, std::ios::binary | std::ios::trunc ) << corrupt;
+        try
+        {
+          NameIndex::load( image );
+          throw UndetectedException( "Corrupt name index image not detected", __LINE__, __func__, __FILE__ );
+        }
+        catch( const NameIndex::NameIndexExceptions & ) {}
+      }
+
+      NameIndex().save( image );
+      if( NameIndex::load( image ).size() != 0  ||  !NameIndex().complete( "a", 10 ).empty() )
+      {
+        throw RegressionTestException( "Empty name index found names", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    std::remove( records.c_str() );
+    std::remove( image.c_str() );
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runNameIndexTest()
+
+
+
+  /****************************************************************************
+  ** Employee Directory Verification & Regression Test
+  **
+  ** Posting lists survive compression and intersect the same with every
+  ** instruction set, and fuzzy and fragment searches find what comparing the
+  ** query to every employee finds.
+  ****************************************************************************/
+  void runDirectoryTest()
+  {
+    using Employees::Directory;
+    using Employees::Employee;
+
+    std::mt19937 random( 25 );
+
+    // posting lists
+    for( unsigned trial = 0; trial < 50; ++trial )
+    {
+      std::vector<std::uint32_t> lhs, rhs;
+      for( std::uint32_t id = 0; id < 5000; ++id )
+      {
+        if( random() % ( 2 + trial % 7 ) == 0 )  lhs.push_back( id * ( 1 + trial % 3 ) * 997 );
+        if( random() % ( 2 + trial % 5 ) == 0 )  rhs.push_back( id * ( 1 + trial % 3 ) * 997 );
+      }
+
+      std::vector<std::uint8_t>  bytes;
+      std::vector<std::uint32_t> decoded( lhs.size() );
+      Utilities::Postings::encode( lhs.data(), lhs.size(), bytes );
+      if( Utilities::Postings::decode( bytes.data(), lhs.size(), decoded.data() ) != bytes.size()  ||  decoded != lhs )
+      {
+        throw SemmetricalIOFailure( "Posting list changed in compression", __LINE__, __func__, __FILE__ );
+      }
+
+      std::vector<std::uint32_t> expected;
+      std::set_intersection( lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter( expected ) );
+      for( auto isa : { Utilities::Simd::Isa::SCALAR, Utilities::Simd::Isa::SSE2, Utilities::Simd::Isa::AVX2 } )
+      {
+        std::vector<std::uint32_t> out = lhs;   // in place
+        out.resize( Utilities::Postings::intersect( out.data(), out.size(), rhs.data(), rhs.size(), out.data(), isa ) );
+        if( out != expected )  throw RelationalTestFailure( "Posting list intersection wrong", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    // a roster of made up names, with a few real ones to find
+    const char * const syllables[] = { "an", "ber", "co", "da", "el", "fi", "gar", "ho", "is", "jo", "ka", "li", "mo", "ne", "or", "pe" };
+    auto makeName = [&]()
+    {
+      std::string name;
+      for( unsigned s = 0, count = 2 + random() % 3; s < count; ++s )  name += syllables[random() % 16];
+      name[0] = static_cast<char>( std::toupper( name[0] ) );
+      return name;
+    };
+    std::vector<Employee> roster;
+    for( unsigned i = 0; i < 3000; ++i )  roster.emplace_back( makeName(), random() % 10 ? makeName() : makeName() + ' ' + makeName() );
+    roster.emplace_back( "Bjarne", "Stroustrup" );
+    roster.emplace_back( "Ryan",   "Johnson" );
+    roster.emplace_back( "Thomas", "Bettens" );
+
+    const Directory directory( roster );
+    if( directory.size() != roster.size() )  throw RegressionTestException( "Directory lost employees", __LINE__, __func__, __FILE__ );
+
+    const auto stroustrup = directory.search( "Strostrup", 3 );
+    if( stroustrup.empty()  ||  stroustrup.front().id != 3000 )  throw RegressionTestException( "Directory didn't find Stroustrup", __LINE__, __func__, __FILE__ );
+    if( directory.search( "bjarne STROUSTRUP", 1 ).front().similarity != 1.0 )  throw RegressionTestException( "Directory full name search failed", __LINE__, __func__, __FILE__ );
+
+    // fuzzy search against scoring every employee, with the trigrams built here the way the header describes them
+    auto trigramsOf = []( const std::string & text )
+    {
+      std::vector<std::string> trigrams;
+      std::istringstream words( text );
+      for( std::string word; words >> word; )
+      {
+        for( auto & c : word )  c = static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+        word = "  " + word + " ";
+        for( std::size_t i = 0; i + 3 <= word.size(); ++i )  trigrams.push_back( word.substr( i, 3 ) );
+      }
+      std::sort( trigrams.begin(), trigrams.end() );
+      trigrams.erase( std::unique( trigrams.begin(), trigrams.end() ), trigrams.end() );
+      return trigrams;
+    };
+    auto jaccard = []( const std::vector<std::string> & lhs, const std::vector<std::string> & rhs )
+    {
+      std::vector<std::string> shared;
+      std::set_intersection( lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter( shared ) );
+      return static_cast<double>( shared.size() ) / static_cast<double>( lhs.size() + rhs.size() - shared.size() );
+    };
+
+    for( const std::string query : { "Garcoli", "daelfi hojo", "Johnsen", "bettins", "ANBER", "or" } )
+    {
+      const auto wanted = trigramsOf( query );
+      std::vector<std::pair<double, Directory::EmployeeId>> expected;
+      for( Directory::EmployeeId id = 0; id < roster.size(); ++id )
+      {
+        const double score = std::max( { jaccard( wanted, trigramsOf( roster[id].lastName() ) ),
+                                         jaccard( wanted, trigramsOf( roster[id].firstName() ) ),
+                                         jaccard( wanted, trigramsOf( roster[id].firstName() + ' ' + roster[id].lastName() ) ) } );
+        if( score >= 0.4 )  expected.emplace_back( -score, id );
+      }
+      std::sort( expected.begin(), expected.end() );
+
+      const auto found = directory.search( query, 25, 0.4 );
+      bool same = found.size() == std::min<std::size_t>( expected.size(), 25 );
+      for( std::size_t i = 0; same  &&  i < found.size(); ++i )
+      {
+        same = found[i].id == expected[i].second  &&  std::fabs( found[i].similarity + expected[i].first ) < 1e-12;
+      }
+      if( !same )  throw RelationalTestFailure( "Directory search for \"" + query + "\" disagrees with a scan", __LINE__, __func__, __FILE__ );
+    }
+
+    // fragment search against a substring scan
+    for( const std::string fragment : { "ber", "GARCO", "ansen", "o", "kaka", "e d", "zz" } )
+    {
+      std::string folded = fragment;
+      for( auto & c : folded )  c = static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+
+      std::vector<Directory::EmployeeId> expected;
+      for( Directory::EmployeeId id = 0; id < roster.size(); ++id )
+      {
+        std::string first = roster[id].firstName(), last = roster[id].lastName();
+        for( auto & c : first )  c = static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+        for( auto & c : last  )  c = static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) );
+        if( first.find( folded ) != std::string::npos  ||  last.find( folded ) != std::string::npos )  expected.push_back( id );
+      }
+      if( directory.containing( fragment ) != expected )
+      {
+        throw RelationalTestFailure( "Directory fragment search for \"" + fragment + "\" disagrees with a scan", __LINE__, __func__, __FILE__ );
+      }
+    }
+
+    if( !Directory().search( "anyone" ).empty()  ||  !directory.search( "", 10 ).empty() )
+    {
+      throw RegressionTestException( "Directory found names it should not have", __LINE__, __func__, __FILE__ );
+    }
+
+    std::cout << "Success:  " << __func__ << "\v\n";
+  }  // void runDirectoryTest()
+}// unnamed, anonymous namespace
+
+int main()
+{
+  try
+  {
+    const auto seperator = std::string( 80, '=' );
+	
+    ::runAddressTest();
+    std::cout << seperator << '\n';
+
+    ::runZipCodeTest();
+    std::cout << seperator << '\n';
+
+    ::runAddressTableTest();
+    std::cout << seperator << '\n';
+
+    ::runCompanyTest();
+    std::cout << seperator << '\n';
+
+    ::runEmployeeTest();
+    std::cout << seperator << '\n';
+
+    ::runRecordFileTest();
+    std::cout << seperator << '\n';
+
+    ::runRecordFramerTest();
+    std::cout << seperator << '\n';
+
+    ::runParallelLoaderTest();
+    std::cout << seperator << '\n';
+
+    ::runBinaryFormatTest();
+    std::cout << seperator << '\n';
+
+    ::runAddressValidationTest();
+    std::cout << seperator << '\n';
+
+    ::runExceptionTest();
+    std::cout << seperator << '\n';
+
+    ::runEmployeeNameTest();
+    std::cout << seperator << '\n';
+
+    ::runRecordFormattingTest();
+    std::cout << seperator << '\n';
+
+    ::runMoveSemanticsTest();
+    std::cout << seperator << '\n';
+
+    ::runCollationTest();
+    std::cout << seperator << '\n';
+
+    ::runPresortTest();
+    std::cout << seperator << '\n';
+
+    ::runExternalSortTest();
+    std::cout << seperator << '\n';
+
+    ::runHashTest();
+    std::cout << seperator << '\n';
+
+    ::runDeduplicationTest();
+    std::cout << seperator << '\n';
+
+    ::runBloomFilterTest();
+    std::cout << seperator << '\n';
+
+    ::runRegistryTest();
+    std::cout << seperator << '\n';
+
+    ::runConcurrentRegistryTest();
+    std::cout << seperator << '\n';
+
+    ::runZipIndexTest();
+    std::cout << seperator << '\n';
+
+    ::runNameIndexTest();
+    std::cout << seperator << '\n';
+
+    ::runDirectoryTest();
     std::cout << seperator << '\n';
 
 